@@ -0,0 +1,63 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/class.hpp>
+#include <observable/value.hpp>
+
+#include <string>
+#include <vector>
+
+/// Assignment of a large payload through `value` and `class_`: copy
+/// of a lvalue, move of a rvalue and in place mutation.
+
+struct model_t
+{ std::vector<double> samples; };
+
+struct samples{};
+
+using omodel_t = observable::class_<
+    model_t,
+    std::pair<std::vector<double>, samples>>;
+
+int main()
+{
+    constexpr std::size_t n = 20000;
+    const std::vector<double> payload(4096, 1.0);
+    
+    model_t model;
+    omodel_t omodel(model, model.samples);
+    omodel.on_change([](const model_t& m){ do_not_optimize(m); });
+    
+    std::vector<double> d;
+    observable::value<std::vector<double>> od(d);
+    od.on_change([](const std::vector<double>& v){ do_not_optimize(v); });
+    
+    bench("value::assign(lvalue)", n,
+          [&](std::size_t){ od.assign(payload); });
+    
+    bench("value::assign(rvalue)", n,
+          [&](std::size_t){ od.assign(std::vector<double>(payload)); });
+    
+    bench("value::modify", n,
+          [&](std::size_t i){ od.modify([i](std::vector<double>& v)
+                                        { v[i % v.size()] = i; }); });
+    
+    model.samples.clear();
+    bench("class_::assign<Tag>(lvalue)", n,
+          [&](std::size_t){ omodel.assign<samples>(payload); });
+    
+    bench("class_::assign<Tag>(rvalue)", n,
+          [&](std::size_t)
+          { omodel.assign<samples>(std::vector<double>(payload)); });
+    
+    bench("class_::modify<Tag>", n,
+          [&](std::size_t i)
+          {
+              omodel.modify<samples>([i](std::vector<double>& v)
+                                     { v[i % v.size()] = i; });
+          });
+}
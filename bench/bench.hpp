@@ -0,0 +1,31 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/// Runs `f` `n` times and prints the mean time of one execution.
+template<typename F>
+inline double bench(const std::string& name, std::size_t n, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < n; ++i) f(i);
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration<double, std::nano>(end - start).count() / n;
+    std::cout << std::left << std::setw(48) << name
+              << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1) << ns << " ns/op" << std::endl;
+    return ns;
+}
+
+/// Prevents the compiler from optimizing away `o`.
+template<typename T>
+inline void do_not_optimize(const T& o)
+{ asm volatile("" : : "g"(&o) : "memory"); }
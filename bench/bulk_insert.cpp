@@ -0,0 +1,46 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/unordered_map.hpp>
+#include <observable/unordered_set.hpp>
+
+#include <unordered_map>
+#include <unordered_set>
+
+/// Insertion of 100000 elements through the proxies of unordered
+/// containers, with and without `reserve()` before the insertions.
+
+constexpr std::size_t size = 100000;
+
+template<typename Container, typename Insert>
+void run(const std::string& name, Insert insert)
+{
+    constexpr std::size_t n = 20;
+    for (bool reserve : {false, true})
+        bench(name + (reserve ? " with reserve" : " without reserve"), n,
+              [&](std::size_t)
+              {
+                  Container c;
+                  observable::observable_of_t<Container> oc(c);
+                  oc.on_change([](const Container& c){ do_not_optimize(c); });
+                  if (reserve) oc.reserve(size);
+                  for (std::size_t i = 0; i < size; ++i) insert(oc, i);
+                  do_not_optimize(c);
+              });
+}
+
+int main()
+{
+    run<std::unordered_map<std::size_t, std::size_t>>
+        ("unordered_map", [](observable::unordered_map<
+                              std::unordered_map<std::size_t, std::size_t>>& o,
+                              std::size_t i){ o.emplace(i, i); });
+    run<std::unordered_set<std::size_t>>
+        ("unordered_set", [](observable::unordered_set<
+                              std::unordered_set<std::size_t>>& o,
+                              std::size_t i){ o.emplace(i); });
+}
@@ -0,0 +1,59 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/class.hpp>
+#include <observable/lazy_class.hpp>
+#include <observable/observable_class_gen.hpp>
+
+#include <boost/preprocessor.hpp>
+
+/// Construction of a generated class with 64 members through `class_`
+/// and `lazy_class_`, followed or not by the use of one member.
+
+#define MEMBERS 64
+
+#define FIELD(z, n, _) double BOOST_PP_CAT(f, n);
+#define MEMBER(z, n, _) ((double, BOOST_PP_CAT(m, n)))
+#define ARG(z, n, _) model.BOOST_PP_CAT(f, n)
+
+struct model_t
+{ BOOST_PP_REPEAT(MEMBERS, FIELD, _) };
+
+OBSERVABLE_CLASS_GEN(omodel_t, model_t, BOOST_PP_REPEAT(MEMBERS, MEMBER, _));
+
+using lazy_omodel_t = observable::lazy_class_<
+    model_t, OBSERVABLE_gen_members(BOOST_PP_REPEAT(MEMBERS, MEMBER, _))>;
+
+int main()
+{
+    constexpr std::size_t n = 20000;
+    model_t model{};
+
+    bench("class_ ctor", n, [&](std::size_t)
+          {
+              omodel_t o(model, BOOST_PP_ENUM(MEMBERS, ARG, _));
+              do_not_optimize(o);
+          });
+
+    bench("lazy_class_ ctor", n, [&](std::size_t)
+          {
+              lazy_omodel_t o(model, BOOST_PP_ENUM(MEMBERS, ARG, _));
+              do_not_optimize(o);
+          });
+
+    bench("class_ ctor + assign<Tag>", n, [&](std::size_t i)
+          {
+              omodel_t o(model, BOOST_PP_ENUM(MEMBERS, ARG, _));
+              o.assign<m7>(i);
+          });
+
+    bench("lazy_class_ ctor + assign<Tag>", n, [&](std::size_t i)
+          {
+              lazy_omodel_t o(model, BOOST_PP_ENUM(MEMBERS, ARG, _));
+              o.assign<m7>(i);
+          });
+}
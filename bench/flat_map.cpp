@@ -0,0 +1,50 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/flat_map.hpp>
+#include <observable/map.hpp>
+
+#include <boost/container/flat_map.hpp>
+
+#include <map>
+
+/// Lookup, iteration and changes of elements of `map` and `flat_map`
+/// with 1000 elements.
+
+template<typename Map>
+void run(const std::string& name)
+{
+    constexpr std::size_t n = 200000;
+    constexpr int size = 1000;
+    Map m;
+    observable::observable_of_t<Map> om(m);
+    for (int i = 0; i < size; ++i) om.emplace(i * 7, i);
+    om.on_change([](const Map& c){ do_not_optimize(c); });
+
+    bench(name + "::get().find", n, [&](std::size_t i)
+          { do_not_optimize(om.get().find((i % size) * 7)->second); });
+
+    bench(name + " iteration (1000 elements)", n / 100, [&](std::size_t)
+          {
+              long sum{0};
+              for (auto it = om.cbegin(); it != om.cend(); ++it)
+                  sum += it->second;
+              do_not_optimize(sum);
+          });
+
+    bench(name + "::modify", n, [&](std::size_t i)
+          { om.modify((i % size) * 7, [](int& v){ ++v; }); });
+
+    bench(name + "::at()->assign", n, [&](std::size_t i)
+          { om.at((i % size) * 7)->assign(int(i)); });
+}
+
+int main()
+{
+    run<std::map<int, int>>("map");
+    run<boost::container::flat_map<int, int>>("flat_map");
+}
@@ -0,0 +1,60 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/map.hpp>
+
+#include <map>
+
+/// Changes of a map with 10000 keys observed by 100 subscribers, each
+/// one interested in a band of 100 keys, through `on_value_change`
+/// with a filter in each slot and through `on_range_change`.
+
+using map_t = std::map<int, int>;
+
+constexpr int size = 10000;
+constexpr int subscribers = 100;
+constexpr int band = size / subscribers;
+
+int main()
+{
+    constexpr std::size_t n = 100000;
+    long hits{0};
+
+    {
+        map_t m;
+        observable::map<map_t> om(m);
+        for (int i = 0; i < size; ++i) om.emplace(i, i);
+        for (int s = 0; s < subscribers; ++s)
+        {
+            const int lo = s * band, hi = lo + band - 1;
+            om.on_value_change([lo, hi, &hits](const map_t&,
+                                               map_t::const_iterator it)
+                               {
+                                   if (it->first >= lo && it->first <= hi)
+                                       ++hits;
+                               });
+        }
+        bench("map::on_value_change with filters", n, [&](std::size_t i)
+              { om.modify(int(i * 7919) % size, [](int& v){ ++v; }); });
+    }
+
+    {
+        map_t m;
+        observable::map<map_t> om(m);
+        for (int i = 0; i < size; ++i) om.emplace(i, i);
+        for (int s = 0; s < subscribers; ++s)
+        {
+            const int lo = s * band, hi = lo + band - 1;
+            om.on_range_change(lo, hi, [&hits](const map_t&, const int&)
+                               { ++hits; });
+        }
+        bench("map::on_range_change", n, [&](std::size_t i)
+              { om.modify(int(i * 7919) % size, [](int& v){ ++v; }); });
+    }
+
+    do_not_optimize(hits);
+}
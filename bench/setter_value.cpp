@@ -0,0 +1,52 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/setter_value.hpp>
+
+/// Tight assign loop of a `setter_value` using std::function, lambda
+/// expressions and member functions as setter and getter.
+
+struct foo_t
+{
+    void val(double v)
+    { _v = v; }
+    
+    const double& val() const noexcept
+    { return _v; }
+private:
+    double _v{0};
+};
+
+template<typename SetGet>
+void run(const std::string& name, SetGet sg)
+{
+    observable::setter_value<SetGet> o(std::move(sg));
+    bench(name, 10000000, [&o](std::size_t i)
+          {
+              o.assign(double(i));
+              do_not_optimize(o.get());
+          });
+}
+
+int main()
+{
+    foo_t foo;
+    auto setter = [&foo](double v){ foo.val(v); };
+    auto getter = [&foo]() -> const double& { return foo.val(); };
+    
+    run("std::function", observable::set_get<double>{setter, getter});
+    
+    run("lambda expressions",
+        observable::make_set_get<double>(setter, getter));
+    
+    run("member functions",
+        observable::set_get<
+            double,
+            observable::mem_setter<foo_t, double, &foo_t::val>,
+            observable::mem_getter<foo_t, double, &foo_t::val>
+        >{{&foo}, {&foo}});
+}
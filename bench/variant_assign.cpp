@@ -0,0 +1,51 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/class.hpp>
+#include <observable/observable_is_class.hpp>
+#include <observable/variant.hpp>
+
+#include <string>
+
+/// Assignment of a `variant<int, class_>` keeping the alternative and
+/// switching it.
+
+struct foo_t{ int i; std::string s; };
+struct i{};
+struct s{};
+using ofoo_t = observable::class_<
+    foo_t,
+    std::pair<int, i>,
+    std::pair<std::string, s>>;
+
+ofoo_t observable_factory(foo_t& o)
+{ return ofoo_t(o, o.i, o.s); }
+
+OBSERVABLE_IS_CLASS(ofoo_t)
+
+using variant_t = boost::variant<int, foo_t>;
+
+int main()
+{
+    constexpr std::size_t n = 200000;
+    variant_t v{foo_t{0, "abc"}};
+    observable::variant<variant_t> ov(v);
+    ov.on_change([](const variant_t& v){ do_not_optimize(v); });
+    
+    bench("same alternative (class_)", n,
+          [&](std::size_t n){ ov = foo_t{int(n), "abc"}; });
+    
+    bench("same alternative (int)", n,
+          [&](std::size_t n){ ov = int(n); });
+    
+    bench("switching alternative", n,
+          [&](std::size_t n)
+          {
+              if (n % 2) ov = int(n);
+              else ov = foo_t{int(n), "abc"};
+          });
+}
@@ -0,0 +1,52 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include "bench.hpp"
+
+#include <observable/deque.hpp>
+#include <observable/ring_buffer.hpp>
+#include <observable/vector.hpp>
+
+#include <boost/circular_buffer.hpp>
+
+#include <deque>
+#include <vector>
+
+/// Sliding window of 10000 ticks: push at the back and remove the
+/// oldest tick from the front with `vector`, `deque` and
+/// `ring_buffer`.
+
+int main()
+{
+    constexpr std::size_t n = 100000;
+    constexpr std::size_t window = 10000;
+
+    std::vector<double> v(window, 1.0);
+    observable::vector<std::vector<double>> ov(v);
+    ov.on_change([](const std::vector<double>& c){ do_not_optimize(c); });
+    bench("vector push_back + erase(begin)", n, [&](std::size_t i)
+          {
+              ov.push_back(i);
+              ov.erase(ov.begin());
+          });
+
+    std::deque<double> d(window, 1.0);
+    observable::deque<std::deque<double>> od(d);
+    od.on_change([](const std::deque<double>& c){ do_not_optimize(c); });
+    bench("deque push_back + pop_front", n, [&](std::size_t i)
+          {
+              od.push_back(i);
+              od.pop_front();
+          });
+
+    boost::circular_buffer<double> b(window, window, 1.0);
+    observable::ring_buffer<boost::circular_buffer<double>> ob(b);
+    ob.on_change([](const boost::circular_buffer<double>& c)
+                 { do_not_optimize(c); });
+    ob.on_evict([](const boost::circular_buffer<double>&, const double& e)
+                { do_not_optimize(e); });
+    bench("ring_buffer push_back (evicts)", n, [&](std::size_t i)
+          { ob.push_back(i); });
+}
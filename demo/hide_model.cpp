@@ -1,25 +1,31 @@
-#include "observable_person.hpp"
 #include "person.hpp"
+
+#include <observable/map.hpp>
+#include <observable/observable_class_gen.hpp>
+#include <observable/owning_class.hpp>
+#include <observable/unordered_set.hpp>
+
+#include <cstddef>
 #include <iostream>
+#include <string>
 
-struct operson_t : observable_person
-{
-    using base = observable_person;
-    
-    operson_t(person_t model)
-        : base(observable_factory(_model))
-        , _model(std::move(model))
-    {}
-private:
-    person_t _model;
-};
+/// The model of the person is hidden inside of the observable: the
+/// owning class stores the fields next to their signals, so there is
+/// no `person_t` to bypass the observable.
+OBSERVABLE_OWNING_CLASS_GEN(
+    operson_t,
+    ((std::string, name))
+    ((std::size_t, age))
+    ((skills_t, skills))
+    ((kids_t, kids))
+);
 
 int main()
 {
-    operson_t person{person_t{"maria", 26}};
+    operson_t person{"maria", std::size_t{26}, skills_t{}, kids_t{}};
 
     person.on_change(
-        [](const person_t& name)
+        [](const operson_t&)
         {std::cout << "person has changed" << std::endl;});
     
     person.get<kids>().on_insert(
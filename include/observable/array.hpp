@@ -0,0 +1,210 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace observable {
+
+template<typename Observed_>
+struct array;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_array<Observed>::value>::type
+>
+{
+    using type = array<Observed>;
+};
+
+/// Observable of a `std::array`. Each change of an element emits the
+/// signal of its index, `on_value_change` and `on_change`; the
+/// elements aren't compared or copied to notify a change.
+///
+/// The elements are read through const access and changed by
+/// `assign()` and `modify()`, which check the index at compile time
+/// when it's a template argument.
+template<typename Observed_>
+struct array
+{
+    using Observed = Observed_;
+
+    using value_type = typename Observed::value_type;
+    using const_reference = typename Observed::const_reference;
+    using const_pointer = typename Observed::const_pointer;
+    using const_iterator = typename Observed::const_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+
+    array() = default;
+
+    array(Observed& observed)
+        : _observed(&observed)
+    {}
+
+    const_iterator begin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_reverse_iterator crbegin() const noexcept
+    { return _observed->crbegin(); }
+
+    const_iterator end() const noexcept
+    { return _observed->cend(); }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    const_reverse_iterator crend() const noexcept
+    { return _observed->crend(); }
+
+    constexpr bool empty() const noexcept
+    { return extent == 0; }
+
+    constexpr size_type size() const noexcept
+    { return extent; }
+
+    constexpr size_type max_size() const noexcept
+    { return extent; }
+
+    const_reference at(size_type pos) const
+    { return _observed->at(pos); }
+
+    const_reference operator[](size_type pos) const
+    { return (*_observed)[pos]; }
+
+    const_reference front() const
+    { return _observed->front(); }
+
+    const_reference back() const
+    { return _observed->back(); }
+
+    template<size_type I>
+    const_reference get() const noexcept
+    {
+        static_assert(I < extent, "index out of bounds");
+        return std::get<I>(*_observed);
+    }
+
+    template<size_type I, typename T>
+    void assign(T&& o)
+    {
+        static_assert(I < extent, "index out of bounds");
+        std::get<I>(*_observed) = std::forward<T>(o);
+        notify(I);
+    }
+
+    void assign(size_type pos, const value_type& o)
+    {
+        if (pos >= extent) throw std::out_of_range("array::assign");
+        (*_observed)[pos] = o;
+        notify(pos);
+    }
+
+    void assign(size_type pos, value_type&& o)
+    {
+        if (pos >= extent) throw std::out_of_range("array::assign");
+        (*_observed)[pos] = std::move(o);
+        notify(pos);
+    }
+
+    /// Mutates the element `I` in place through `f`
+    template<size_type I, typename F>
+    void modify(F&& f)
+    {
+        static_assert(I < extent, "index out of bounds");
+        std::forward<F>(f)(std::get<I>(*_observed));
+        notify(I);
+    }
+
+    template<typename F>
+    void modify(size_type pos, F&& f)
+    {
+        if (pos >= extent) throw std::out_of_range("array::modify");
+        std::forward<F>(f)((*_observed)[pos]);
+        notify(pos);
+    }
+
+    /// Assigns `o` to every element, emitting the signals of each
+    /// index and `on_value_change` for each element but `on_change`
+    /// only once.
+    void fill(const value_type& o)
+    {
+        _observed->fill(o);
+        for (size_type pos = 0; pos < extent; ++pos)
+        {
+            _on_index_change[pos](o);
+            _on_value_change(*_observed, _observed->cbegin() + pos);
+        }
+        _on_change(*_observed);
+    }
+
+    /// Connects `f(const value_type&)` to the changes of the element
+    /// `I`
+    template<size_type I, typename F>
+    boost::signals2::connection on_change(F&& f)
+    {
+        static_assert(I < extent, "index out of bounds");
+        return std::get<I>(_on_index_change).connect(std::forward<F>(f));
+    }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    static constexpr size_type extent = std::tuple_size<Observed>::value;
+
+    Observed* _observed{nullptr};
+
+    std::array<detail::lazy_signal<void(const value_type&)>, extent>
+    _on_index_change;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_value_change;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+private:
+    void notify(size_type pos)
+    {
+        _on_index_change[pos]((*_observed)[pos]);
+        _on_value_change(*_observed, _observed->cbegin() + pos);
+        _on_change(*_observed);
+    }
+};
+
+template<typename Observed>
+constexpr typename array<Observed>::size_type array<Observed>::extent;
+
+namespace detail {
+
+template<typename Observed>
+struct is_assignable_in_place<array<Observed>> : std::true_type {};
+
+}
+
+}
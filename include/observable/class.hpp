@@ -6,6 +6,11 @@
 
 #pragma once
 
+#include "observable/detail/access.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/detail/member_mask.hpp"
+#include "observable/detail/type_list.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
@@ -17,25 +22,11 @@
 #include <boost/signals2.hpp>
 
 #include <array>
+#include <cstddef>
 #include <type_traits>
 
 namespace observable {
 
-template<typename>
-struct map;
-    
-template<typename>
-struct unordered_map;
-    
-template<typename>
-struct unordered_set;
-    
-template<typename>
-struct variant;
-    
-template<typename>
-struct vector;
-
 template<typename Parent>    
 struct set_on_change
 {
@@ -48,10 +39,14 @@ struct set_on_change
     void operator()(T& o) const
     {
         auto& parent = _parent;
+        std::size_t member = _it - parent.observable_on_change_conns.begin();
         *_it++ = 
             o.second.on_change(
-            [&parent](const typename T::second_type::Observed&)
-            { parent._on_change(parent.get()); });
+            [&parent, member](const typename T::second_type::Observed&)
+            {
+                parent._on_member_change(parent.get(), member);
+                parent._on_change(parent.get());
+            });
     }
     
     Parent& _parent;
@@ -78,6 +73,7 @@ public:
             typename Members::second_type,
             observable_of_t<typename Members::first_type>
         >...>;
+    using Tags = detail::type_list<typename Members::second_type...>;
 
     class_() = default;
 
@@ -88,8 +84,8 @@ public:
         , _tag2observable
           (boost::fusion::pair<
            typename Members::second_type,
-           observable_of_t<typename std::decay<Observeds>::type>>
-           (observable_of_t<typename std::decay<Observeds>::type>
+           observable_of_t<typename Members::first_type>>
+           (observable_of_t<typename Members::first_type>
             (observable_factory(std::forward<Observeds>(observeds))))...)
     {
         set_on_change<class_<Observed_, Members...>> visitor{*this};
@@ -99,6 +95,7 @@ public:
     class_(class_&& rhs) noexcept
         : _observed(rhs._observed)
         , _on_change(std::move(rhs._on_change))
+        , _on_member_change(std::move(rhs._on_member_change))
     {
         rhs.observable_on_change_conns.swap(observable_on_change_conns);
         set_on_change<class_<Observed_, Members...>> visitor{*this};
@@ -114,12 +111,17 @@ public:
         boost::fusion::for_each(rhs._tag2observable, visitor);
         boost::fusion::move(std::move(rhs._tag2observable), _tag2observable);
         _on_change = std::move(rhs._on_change);
+        _on_member_change = std::move(rhs._on_member_change);
         return *this;
     }
     
     template<typename Tag, typename T>
-    void assign(T o)
-    { return boost::fusion::at_key<Tag>(_tag2observable).assign(std::move(o)); }
+    void assign(T&& o)
+    { boost::fusion::at_key<Tag>(_tag2observable).assign(std::forward<T>(o)); }
+
+    template<typename Tag, typename F>
+    void modify(F&& f)
+    { boost::fusion::at_key<Tag>(_tag2observable).modify(std::forward<F>(f)); }
 
     template<typename Tag>
     auto get() ->
@@ -138,6 +140,32 @@ public:
     template<typename F>
     boost::signals2::connection on_change(F&& f)
     { return _on_change.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, std::size_t member)` to the
+    /// changes of the members, where `member` is the position of the
+    /// member that has changed, the same one of `index<Tag>()`. It's
+    /// emitted before `on_change`.
+    template<typename F>
+    boost::signals2::connection on_member_change(F&& f)
+    { return _on_member_change.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&)` to the changes of any one of
+    /// the members identified by `Tags_`. There is only one slot,
+    /// which tests the bit of the member that has changed.
+    template<typename... Tags_, typename F>
+    boost::signals2::connection on_change_any(F&& f)
+    {
+        using mask_t = detail::member_mask<Tags, Tags_...>;
+        return _on_member_change.connect(
+            detail::masked_slot<typename std::decay<F>::type,
+                                typename mask_t::type>
+            {std::forward<F>(f), mask_t::get()});
+    }
+
+    /// Position of the member identified by `Tag`
+    template<typename Tag>
+    static constexpr std::size_t index() noexcept
+    { return detail::index_of<Tag, Tags>::value; }
     
     const Observed& get() const noexcept
     { return *_observed; }
@@ -146,33 +174,27 @@ private:
     
     Observed* _observed{nullptr};
     Tag2Observable _tag2observable;
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&, std::size_t)> _on_member_change;
 
     using observable_on_change_conns_t =
         std::array<boost::signals2::scoped_connection, sizeof...(Members)>;
     
     observable_on_change_conns_t observable_on_change_conns;
     
-    template<typename>
-    friend struct observable::map;
-    
-    template<typename>
-    friend struct observable::value;
-    
-    template<typename>
-    friend struct observable::variant;
-    
-    template<typename>
-    friend struct observable::vector;
-    
-    template<typename>
-    friend struct observable::unordered_map;
-    
-    template<typename>
-    friend struct observable::unordered_set;
+    friend struct detail::access;
     
     template<typename>
     friend struct set_on_change;
 };
 
+namespace detail {
+
+template<typename Observed, typename... Members>
+struct is_assignable_in_place<class_<Observed, Members...>>
+    : all_assignable_in_place<
+        observable_of_t<typename Members::first_type>...> {};
+
+}
+
 }
@@ -0,0 +1,213 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace observable {
+
+template<typename Observed_>
+struct deque;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_deque<Observed>::value>::type
+>
+{
+    using type = deque<Observed>;
+};
+
+/// Observable of a `std::deque` with insertions and removals at both
+/// ends in constant time. Each one emits one signal about the element
+/// and `on_change`.
+///
+/// The elements are read through const access and changed by
+/// `modify()`; there are no observables of the elements.
+template<typename Observed_>
+struct deque
+{
+    using Observed = Observed_;
+
+    using value_type = typename Observed::value_type;
+    using const_reference = typename Observed::const_reference;
+    using const_pointer = typename Observed::const_pointer;
+    using const_iterator = typename Observed::const_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    deque() = default;
+
+    deque(Observed& observed)
+        : _observed(&observed)
+    {}
+
+    const_iterator begin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_reverse_iterator crbegin() const noexcept
+    { return _observed->crbegin(); }
+
+    const_iterator end() const noexcept
+    { return _observed->cend(); }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    const_reverse_iterator crend() const noexcept
+    { return _observed->crend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    void shrink_to_fit()
+    { _observed->shrink_to_fit(); }
+
+    const_reference at(size_type pos) const
+    { return _observed->at(pos); }
+
+    const_reference operator[](size_type pos) const
+    { return (*_observed)[pos]; }
+
+    const_reference front() const
+    { return _observed->front(); }
+
+    const_reference back() const
+    { return _observed->back(); }
+
+    /// Mutates the element at `pos` in place through `f` and emits
+    /// `on_value_change` and `on_change`.
+    template<typename F>
+    void modify(size_type pos, F&& f)
+    {
+        if (pos >= _observed->size())
+            throw std::out_of_range("deque::modify");
+        auto it = _observed->begin() + pos;
+        std::forward<F>(f)(*it);
+        _on_value_change(*_observed, it);
+        _on_change(*_observed);
+    }
+
+    void clear() noexcept
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->clear();
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    const_iterator erase(const_iterator pos)
+    {
+        _before_erase(*_observed, pos);
+        auto it = _observed->erase(pos);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    const_iterator erase(const_iterator first, const_iterator last)
+    {
+        _before_erase(*_observed, first);
+        auto it = _observed->erase(first, last);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    void push_back(const value_type& value)
+    { emplace_back(value); }
+
+    void push_back(value_type&& value)
+    { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        _observed->emplace_back(std::forward<Args>(args)...);
+        _on_insert(*_observed, std::prev(_observed->cend()));
+        _on_change(*_observed);
+    }
+
+    void push_front(const value_type& value)
+    { emplace_front(value); }
+
+    void push_front(value_type&& value)
+    { emplace_front(std::move(value)); }
+
+    template<typename... Args>
+    void emplace_front(Args&&... args)
+    {
+        _observed->emplace_front(std::forward<Args>(args)...);
+        _on_insert(*_observed, _observed->cbegin());
+        _on_change(*_observed);
+    }
+
+    void pop_back()
+    {
+        _before_erase(*_observed, std::prev(_observed->cend()));
+        _observed->pop_back();
+        _on_erase(*_observed, _observed->cend());
+        _on_change(*_observed);
+    }
+
+    void pop_front()
+    {
+        _before_erase(*_observed, _observed->cbegin());
+        _observed->pop_front();
+        _on_erase(*_observed, _observed->cbegin());
+        _on_change(*_observed);
+    }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _on_value_change, _before_erase;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+};
+
+}
@@ -0,0 +1,22 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+namespace observable { namespace detail {
+
+/// Access of the proxies that hold observables, like the containers,
+/// `variant` and `optional`, to the `on_change` signal of those
+/// observables, which they emit and connect to forward the changes.
+/// An observable whose signal is private befriends this class, like
+/// `boost::iterator_core_access`, instead of each proxy.
+struct access
+{
+    template<typename Observable>
+    static auto on_change(Observable& o) noexcept -> decltype((o._on_change))
+    { return o._on_change; }
+};
+
+}}
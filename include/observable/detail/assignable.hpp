@@ -0,0 +1,58 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <boost/none.hpp>
+#include <boost/optional.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace observable { namespace detail {
+
+/// Default constructible and move assignable holder of a callable
+/// like a lambda expression, which isn't. The call isn't type erased.
+template<typename F>
+class assignable
+{
+public:
+    assignable() = default;
+    
+    assignable(F f)
+        : _f(std::move(f))
+    {}
+
+    assignable(assignable&& rhs) noexcept
+        : _f(std::move(rhs._f))
+    {}
+
+    assignable& operator=(assignable&& rhs) noexcept
+    {
+        _f = boost::none;
+        if (rhs._f) _f.emplace(std::move(*rhs._f));
+        return *this;
+    }
+    
+    template<typename... Args>
+    auto operator()(Args&&... args) const
+        -> decltype(std::declval<const F&>()(std::forward<Args>(args)...))
+    { return (*_f)(std::forward<Args>(args)...); }
+    
+private:
+    boost::optional<F> _f;
+};
+
+/// `F` if it's default constructible and move assignable and
+/// `assignable<F>` otherwise.
+template<typename F>
+using assignable_t = typename std::conditional<
+    std::is_default_constructible<F>::value
+    && std::is_move_assignable<F>::value,
+    F,
+    assignable<F>
+>::type;
+    
+}}
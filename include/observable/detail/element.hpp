@@ -0,0 +1,86 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+
+namespace observable { namespace detail {
+
+template<typename Allocator, typename T>
+using rebind_alloc_t =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+/// Index of the alive observables of the elements of a container by
+/// the address of the element. Its nodes are allocated by the
+/// allocator of the container.
+template<typename Pointer, typename Reference, typename Allocator>
+using element_index_t = std::unordered_map<
+    Pointer,
+    std::weak_ptr<Reference>,
+    std::hash<Pointer>,
+    std::equal_to<Pointer>,
+    rebind_alloc_t<Allocator,
+                   std::pair<const Pointer, std::weak_ptr<Reference>>>
+>;
+
+template<typename ElementIndex, typename Allocator>
+inline ElementIndex make_element_index(const Allocator& alloc)
+{
+    return ElementIndex(0, typename ElementIndex::hasher(),
+                        typename ElementIndex::key_equal(),
+                        typename ElementIndex::allocator_type(alloc));
+}
+
+template<typename Allocator, typename F>
+struct element_deleter
+{
+    template<typename T>
+    void operator()(T* p)
+    {
+        on_release();
+        std::allocator_traits<Allocator>::destroy(alloc, p);
+        std::allocator_traits<Allocator>::deallocate(alloc, p, 1);
+    }
+
+    Allocator alloc;
+    F on_release;
+};
+
+/// Creates the observable of an element with the allocator of the
+/// container, which also allocates the control block of the
+/// shared_ptr. `on_release()` is called when the last owner releases
+/// it.
+///
+/// The observable is constructed by placement new instead of the
+/// allocator: the proxies of containers have an `allocator_type`, so a
+/// scoped allocator such as `std::pmr::polymorphic_allocator` would
+/// try a uses-allocator construction that they don't support.
+template<typename Reference, typename Allocator, typename F>
+inline std::shared_ptr<Reference>
+make_element(const Allocator& container_alloc, Reference&& o, F on_release)
+{
+    using alloc_t = rebind_alloc_t<Allocator, Reference>;
+    using traits = std::allocator_traits<alloc_t>;
+    alloc_t alloc(container_alloc);
+    auto p = traits::allocate(alloc, 1);
+    try
+    {
+        ::new (static_cast<void*>(p)) Reference(std::move(o));
+    }
+    catch(...)
+    {
+        traits::deallocate(alloc, p, 1);
+        throw;
+    }
+    return std::shared_ptr<Reference>
+        (p, element_deleter<alloc_t, F>{alloc, std::move(on_release)}, alloc);
+}
+
+}}
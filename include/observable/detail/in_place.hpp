@@ -0,0 +1,32 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <type_traits>
+
+namespace observable { namespace detail {
+
+/// True if an observable stays valid when the value that it observes
+/// is assigned in place, which is the case when it keeps nothing
+/// derived from the value: no observable of an alternative, like
+/// `variant`, and no observables of elements, like the containers.
+template<typename Observable>
+struct is_assignable_in_place : std::false_type {};
+
+template<bool... Bs>
+struct all_of : std::true_type {};
+
+template<bool B, bool... Bs>
+struct all_of<B, Bs...>
+    : std::integral_constant<bool, B && all_of<Bs...>::value> {};
+
+/// An aggregate of observables, like `class_`, is assignable in place
+/// if all of them are.
+template<typename... Observables>
+struct all_assignable_in_place
+    : all_of<is_assignable_in_place<Observables>::value...> {};
+
+}}
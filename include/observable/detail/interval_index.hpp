@@ -0,0 +1,161 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <boost/signals2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace observable { namespace detail {
+
+/// Signals of closed intervals of the keys of the ordered container
+/// `Observed`. A key is dispatched to the signals of the intervals
+/// that contain it.
+///
+/// The intervals are kept split in disjoint segments, each one with
+/// the signals of the intervals that cover it, so the dispatch of a
+/// key is one lookup plus the calls of its k signals: O(log s + k),
+/// with s segments. Connecting an interval is linear in the number of
+/// segments that it covers. Disconnected intervals are removed from
+/// the segments by the next `connect` or after a dispatch finds one
+/// of them.
+template<typename Observed>
+class interval_index
+{
+public:
+    using key_type = typename Observed::key_type;
+    using key_compare = typename Observed::key_compare;
+    using signal_type = boost::signals2::signal<
+        void(const Observed&, const key_type&)>;
+
+    explicit interval_index(key_compare comp)
+        : _segments(boundary_compare{comp})
+    {}
+
+    /// Connects `f` to the keys in [lo, hi]
+    template<typename F>
+    boost::signals2::connection connect(const key_type& lo,
+                                        const key_type& hi,
+                                        F&& f)
+    {
+        if (_dispatching == 0) purge();
+        _signals.emplace_back(new signal_type);
+        auto signal = _signals.back().get();
+        auto conn = signal->connect(std::forward<F>(f));
+        auto first = split(boundary{lo, false});
+        auto last = split(boundary{hi, true});
+        for (; first != last; ++first) first->second.push_back(signal);
+        return conn;
+    }
+
+    void operator()(const Observed& c, const key_type& key)
+    {
+        auto it = _segments.upper_bound(boundary{key, false});
+        if (it == _segments.begin()) return;
+        //a slot may connect another interval, which doesn't remove
+        //segments while a dispatch is running but may grow this one
+        auto& signals = std::prev(it)->second;
+        bool disconnected{false};
+        {
+            dispatch_guard guard{_dispatching};
+            for (std::size_t i = 0, n = signals.size(); i < n; ++i)
+            {
+                if (signals[i]->empty()) disconnected = true;
+                else (*signals[i])(c, key);
+            }
+        }
+        if (disconnected && _dispatching == 0) purge();
+    }
+
+    bool empty() const noexcept
+    { return _signals.empty(); }
+
+private:
+    struct dispatch_guard
+    {
+        explicit dispatch_guard(std::size_t& depth)
+            : depth(depth)
+        { ++depth; }
+
+        ~dispatch_guard()
+        { --depth; }
+
+        std::size_t& depth;
+    };
+
+    /// Position just before `key`, or just after it if `after`
+    struct boundary
+    {
+        key_type key;
+        bool after;
+    };
+
+    struct boundary_compare
+    {
+        bool operator()(const boundary& lhs, const boundary& rhs) const
+        {
+            if (comp(lhs.key, rhs.key)) return true;
+            if (comp(rhs.key, lhs.key)) return false;
+            return lhs.after < rhs.after;
+        }
+
+        key_compare comp;
+    };
+
+    using segments_t = std::map<boundary,
+                                std::vector<signal_type*>,
+                                boundary_compare>;
+
+    /// Returns the segment that starts at `b`, splitting the segment
+    /// that contains it.
+    typename segments_t::iterator split(const boundary& b)
+    {
+        auto it = _segments.lower_bound(b);
+        if (it != _segments.end() && !_segments.key_comp()(b, it->first))
+            return it;
+        auto signals = it == _segments.begin()
+            ? std::vector<signal_type*>{}
+            : std::prev(it)->second;
+        return _segments.emplace_hint(it, b, std::move(signals));
+    }
+
+    /// Removes the disconnected intervals and joins the segments that
+    /// become equal to the previous one.
+    void purge()
+    {
+        auto dead = [](signal_type* signal){ return signal->empty(); };
+        for (auto& segment : _segments)
+        {
+            auto& signals = segment.second;
+            signals.erase(std::remove_if(signals.begin(), signals.end(), dead),
+                          signals.end());
+        }
+        _signals.erase(std::remove_if(
+                           _signals.begin(), _signals.end(),
+                           [](const std::unique_ptr<signal_type>& signal)
+                           { return signal->empty(); }),
+                       _signals.end());
+        const std::vector<signal_type*> none;
+        const std::vector<signal_type*>* previous = &none;
+        for (auto it = _segments.begin(); it != _segments.end();)
+        {
+            if (it->second == *previous) it = _segments.erase(it);
+            else previous = &(it++)->second;
+        }
+    }
+
+    segments_t _segments;
+    std::vector<std::unique_ptr<signal_type>> _signals;
+    std::size_t _dispatching{0};
+};
+
+}}
@@ -0,0 +1,61 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <boost/signals2.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace observable { namespace detail {
+
+/// Signal whose implementation is allocated by the first `connect`.
+///
+/// A boost::signals2::signal allocates its implementation when it's
+/// constructed, even if no slot is ever connected. The lazy_signal
+/// has the size of a pointer, doesn't allocate while it doesn't have
+/// slots and emitting it without slots is a null check. The first
+/// `connect` costs the allocation of the signal plus the allocations
+/// that boost::signals2 does to connect a slot.
+///
+/// With this, the proxies `vector`, `map`, `unordered_map` and
+/// `unordered_set` and the observables `value`, `setter_value` and
+/// `variant` don't allocate when they are constructed. A `class_`
+/// connects one slot to each member to forward the changes, so the
+/// signals of its members are allocated with the class.
+template<typename Signature>
+class lazy_signal
+{
+public:
+    using signal_type = boost::signals2::signal<Signature>;
+    
+    lazy_signal() = default;
+    lazy_signal(lazy_signal&&) noexcept = default;
+    lazy_signal& operator=(lazy_signal&&) noexcept = default;
+    
+    template<typename F>
+    boost::signals2::connection connect(F&& f)
+    {
+        if (!_signal) _signal.reset(new signal_type);
+        return _signal->connect(std::forward<F>(f));
+    }
+
+    template<typename... Args>
+    void operator()(Args&&... args) const
+    { if (_signal) (*_signal)(std::forward<Args>(args)...); }
+
+    bool empty() const noexcept
+    { return !_signal || _signal->empty(); }
+
+    std::size_t num_slots() const noexcept
+    { return _signal ? _signal->num_slots() : 0; }
+    
+private:
+    std::unique_ptr<signal_type> _signal;
+};
+        
+}}
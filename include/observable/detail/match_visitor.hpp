@@ -4,6 +4,18 @@
 
 namespace observable { namespace detail {
 
+#ifdef __cpp_variadic_using
+template<typename... Lambdas>    
+struct match_visitor : Lambdas...
+{
+    using result_type = void;
+    using Lambdas::operator()...;
+
+    template<typename... Ls>
+    match_visitor(Ls&&... lambdas) : Lambdas(std::forward<Ls>(lambdas))...
+    {}
+};
+#else
 template<typename... Lambdas>    
 struct match_visitor;
     
@@ -31,6 +43,6 @@ struct match_visitor<Lambda, Lambdas...> : Lambda, match_visitor<Lambdas...>
         , match_visitor<Lambdas...>(std::forward<Ls>(lambdas)...)
     {}
 };
-
+#endif
         
 }}
@@ -0,0 +1,50 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/type_list.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <utility>
+
+namespace observable { namespace detail {
+
+/// Bitset with the positions in `Tags` of the tags `Selected`
+template<typename Tags, typename... Selected>
+struct member_mask;
+
+template<typename... Tags, typename... Selected>
+struct member_mask<type_list<Tags...>, Selected...>
+{
+    static_assert(sizeof...(Selected) > 0, "at least one member is required");
+
+    using type = std::bitset<sizeof...(Tags)>;
+
+    static type get()
+    {
+        type mask;
+        const std::size_t positions[] =
+            {index_of<Selected, type_list<Tags...>>::value...};
+        for (auto pos : positions) mask.set(pos);
+        return mask;
+    }
+};
+
+/// Slot of `on_member_change` that calls `f` only for the members in
+/// `mask`.
+template<typename F, typename Mask>
+struct masked_slot
+{
+    template<typename Observed>
+    void operator()(const Observed& o, std::size_t member)
+    { if (mask[member]) f(o); }
+
+    F f;
+    Mask mask;
+};
+
+}}
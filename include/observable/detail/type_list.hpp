@@ -0,0 +1,60 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <boost/mpl/fold.hpp>
+#include <boost/mpl/placeholders.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace observable { namespace detail {
+
+template<typename... Ts>
+struct type_list {};
+
+template<typename List, typename T>
+struct push_back;
+    
+template<typename... Ts, typename T>
+struct push_back<type_list<Ts...>, T>
+{ using type = type_list<Ts..., T>; };
+
+/// type_list with the types of the MPL sequence `Sequence`
+template<typename Sequence>
+struct as_type_list
+    : boost::mpl::fold<
+        Sequence,
+        type_list<>,
+        push_back<boost::mpl::_1, boost::mpl::_2>
+    >
+{};
+    
+/// Index of the first occurrence of `T` in `List`
+template<typename T, typename List>
+struct index_of;
+
+template<typename T, typename... Ts>
+struct index_of<T, type_list<T, Ts...>>
+    : std::integral_constant<std::size_t, 0> {};
+    
+template<typename T, typename U, typename... Ts>
+struct index_of<T, type_list<U, Ts...>>
+    : std::integral_constant<
+        std::size_t, 1 + index_of<T, type_list<Ts...>>::value> {};
+
+/// Indices 0, ..., N-1, like std::index_sequence of C++14
+template<std::size_t... Is>
+struct index_list {};
+
+template<std::size_t N, std::size_t... Is>
+struct make_index_list : make_index_list<N - 1, N - 1, Is...> {};
+
+template<std::size_t... Is>
+struct make_index_list<0, Is...>
+{ using type = index_list<Is...>; };
+    
+}}
@@ -0,0 +1,95 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/types.hpp"
+#include "observable/detail/type_list.hpp"
+
+#include <boost/config.hpp>
+#include <boost/mpl/transform.hpp>
+#include <boost/variant.hpp>
+
+#include <cstddef>
+#include <utility>
+
+#ifndef BOOST_NO_CXX17_HDR_VARIANT
+#include <variant>
+#endif
+
+namespace observable { namespace detail {
+
+/// Operations of the variant type `Observed` used by
+/// `observable::variant`:
+///
+/// alternatives: type_list with the types of the alternatives
+/// observable_variant_t: variant of the observables of the alternatives
+/// index(v): index of the active alternative of `v`
+/// get<T>(v): the active alternative of `v`, which is of type `T`
+/// visit(visitor, v): applies `visitor` to the active alternative of `v`
+template<typename Observed>
+struct variant_backend;
+
+template<BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct variant_backend<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>>
+{
+    using variant_t = boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>;
+    using alternatives =
+        typename as_type_list<typename variant_t::types>::type;
+    using observable_variant_t = typename boost::make_variant_over<
+        typename boost::mpl::transform<
+          typename variant_t::types,
+          observable_of<boost::mpl::_1>
+        >::type
+    >::type;
+
+    template<typename Variant>
+    static std::size_t index(const Variant& v) noexcept
+    { return v.which(); }
+
+    template<typename T, typename Variant>
+    static T& get(Variant& v)
+    { return boost::get<T>(v); }
+    
+    template<typename Visitor, typename Variant>
+    static void visit(Visitor&& visitor, Variant& v)
+    { boost::apply_visitor(std::forward<Visitor>(visitor), v); }
+};
+
+/// Public typedefs of `observable::variant` that only exist for some
+/// variant types. `types` is the MPL sequence of the alternatives of
+/// a `boost::variant`.
+template<typename Observed>
+struct variant_typedefs {};
+
+template<BOOST_VARIANT_ENUM_PARAMS(typename T)>
+struct variant_typedefs<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>>
+{
+    using types =
+        typename boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>::types;
+};
+
+#ifndef BOOST_NO_CXX17_HDR_VARIANT
+template<typename... Ts>
+struct variant_backend<std::variant<Ts...>>
+{
+    using alternatives = type_list<Ts...>;
+    using observable_variant_t = std::variant<observable_of_t<Ts>...>;
+    
+    template<typename Variant>
+    static std::size_t index(const Variant& v) noexcept
+    { return v.index(); }
+
+    template<typename T, typename Variant>
+    static T& get(Variant& v)
+    { return std::get<T>(v); }
+    
+    template<typename Visitor, typename Variant>
+    static void visit(Visitor&& visitor, Variant& v)
+    { std::visit(std::forward<Visitor>(visitor), v); }
+};
+#endif
+    
+}}
@@ -0,0 +1,37 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <functional>
+
+namespace observable {
+
+/// Binary predicate that considers any two values as different. It's
+/// the default equality policy of the observables: every assignment
+/// emits `on_change`.
+struct never_equal
+{
+    template<typename T, typename U>
+    constexpr bool operator()(const T&, const U&) const noexcept
+    { return false; }
+};
+
+/// Marks a member of `class_` whose assignments are compared with
+/// `Equal` before the observed value is stored. When the new value is
+/// equal to the current one nothing is stored and nothing is
+/// notified, including the `on_change` of the class.
+///
+/// Example: std::pair<distinct<double, approx_equal>, price>
+template<typename T, typename Equal = std::equal_to<T>>
+struct distinct {};
+    
+/// Type of the observable `Observable` using `Equal` as equality
+/// policy. It's specialized by each observable that supports an
+/// equality policy.
+template<typename Observable, typename Equal>
+struct with_equal;
+    
+}
@@ -0,0 +1,506 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/container/flat_map.hpp>
+#include <boost/signals2.hpp>
+#include <boost/iterator.hpp>
+#include <boost/iterator/reverse_iterator.hpp>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace observable {
+
+template<typename Observed_>
+struct flat_map;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_flat_map<Observed>::value>::type
+>
+{
+    using type = flat_map<Observed>;
+};
+
+template<typename Observed>
+class flat_map_iterator
+    : public boost::iterator_adaptor<
+        flat_map_iterator<Observed>,
+        typename Observed::Observed::iterator,
+        std::pair<
+            typename Observed::Observed::key_type,
+            std::shared_ptr<typename Observed::reference>
+        >,
+        boost::random_access_traversal_tag,
+        std::pair<
+            typename Observed::Observed::key_type,
+            std::shared_ptr<typename Observed::reference>
+            >,
+        typename Observed::Observed::difference_type
+    >
+{
+public:
+    flat_map_iterator() = default;
+
+    explicit flat_map_iterator
+    (Observed& observed, const typename Observed::Observed::iterator& it)
+        : flat_map_iterator::iterator_adaptor_(it)
+        , _observed(&observed)
+    {}
+private:
+    friend class boost::iterator_core_access;
+    using value = std::pair<
+        typename Observed::Observed::key_type,
+        std::shared_ptr<typename Observed::reference>
+        >;
+
+    value dereference() const
+    {
+        auto it = this->base_reference();
+        return std::make_pair(it->first, _observed->get_reference(it));
+    }
+    Observed* _observed{nullptr};
+};
+
+/// Observable of a `boost::container::flat_map`. It has the same
+/// signals of `map`.
+///
+/// The elements of a flat map are stored contiguously and are moved
+/// by insertions, erasures and changes of capacity. After each one of
+/// them, the alive observables of the elements that have moved are
+/// rebuilt for their new addresses, like the observable of the
+/// alternative of a `variant`: they keep the slots of their
+/// `on_change`, but not the ones of nested observables, like the
+/// members of a `class_`. The observable of an erased element is
+/// dropped from the index and must not be used.
+template<typename Observed_>
+struct flat_map
+{
+    using Observed = Observed_;
+
+    using key_type = typename Observed::key_type;
+    using mapped_type = typename Observed::mapped_type;
+    using value_type = typename Observed::value_type;
+    using key_compare = typename Observed::key_compare;
+    using reference = observable_of_t<mapped_type>;
+    using const_reference = typename Observed::const_reference;
+    using pointer = reference*;
+    using const_pointer = typename Observed::const_pointer;
+    using iterator = flat_map_iterator<flat_map<Observed>>;
+    using reverse_iterator = boost::reverse_iterator<iterator>;
+    using const_iterator = typename Observed::const_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    flat_map() = default;
+
+    flat_map(Observed& observed)
+        : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
+    {}
+
+    iterator begin() noexcept
+    { return iterator(*this, _observed->begin()); }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator
+            (iterator(*this, _observed->end()));
+    }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_reverse_iterator crbegin() noexcept
+    { return _observed->crbegin(); }
+
+    iterator end() noexcept
+    { return iterator(*this, _observed->end()); }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator
+            (iterator(*this, _observed->begin()));
+    }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    const_reverse_iterator crend() noexcept
+    { return _observed->crend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    size_type capacity() const noexcept
+    { return _observed->capacity(); }
+
+    void reserve(size_type new_cap)
+    {
+        auto alive = alive_elements();
+        _observed->reserve(new_cap);
+        rebind(alive);
+    }
+
+    void shrink_to_fit()
+    {
+        auto alive = alive_elements();
+        _observed->shrink_to_fit();
+        rebind(alive);
+    }
+
+    std::shared_ptr<reference> at(const key_type& key)
+    {
+        auto it = _observed->find(key);
+        if (it == _observed->end())
+            throw std::out_of_range("flat_map::at");
+        return get_reference(it);
+    }
+
+    const mapped_type&
+    at(const key_type& key) const
+    { return _observed->at(key); }
+
+    std::shared_ptr<reference> operator[](const key_type& key)
+    {
+        auto it = _observed->lower_bound(key);
+        if (it == _observed->end() || _observed->key_comp()(key, (*it).first))
+        {
+            auto alive = alive_elements();
+            it = _observed->emplace_hint(it, key, mapped_type());
+            rebind(alive);
+            _on_insert(*_observed, it);
+            _on_change(*_observed);
+        }
+        return get_reference(it);
+    }
+
+    /// Mutates the value mapped to `key` in place through `f` and
+    /// emits `on_value_change` and `on_change`. An observable of the
+    /// element is only notified if it's alive; no observable is
+    /// created.
+    template<typename F>
+    void modify(const key_type& key, F&& f)
+    {
+        auto it = _observed->find(key);
+        if (it == _observed->end())
+            throw std::out_of_range("flat_map::modify");
+        std::forward<F>(f)(it->second);
+        notify_value_change(it);
+    }
+
+    void clear()
+    {
+        _before_erase(*_observed, _observed->cend());
+        auto alive = alive_elements();
+        _observed->clear();
+        rebind(alive);
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        _before_erase(*_observed, pos);
+        auto alive = alive_elements();
+        auto it = _observed->erase(pos);
+        rebind(alive);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    iterator erase(const_iterator first,
+                   const_iterator last)
+    {
+        _before_erase(*_observed, first);
+        auto alive = alive_elements();
+        auto it = _observed->erase(first, last);
+        rebind(alive);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto it = _observed->find(key);
+        if (it == _observed->end()) return 0;
+        erase(it);
+        return 1;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        auto alive = alive_elements();
+        auto ret = _observed->emplace(std::forward<Args>(args)...);
+        rebind(alive);
+        if (ret.second)
+        {
+            _on_insert(*_observed, ret.first);
+            _on_change(*_observed);
+        }
+        return std::make_pair(iterator(*this, ret.first), ret.second);
+    }
+
+    template<typename... Args>
+    iterator emplace_hint
+    (const_iterator hint, Args&&... args)
+    {
+        auto before_size = _observed->size();
+        auto alive = alive_elements();
+        auto it = _observed->emplace_hint(hint, std::forward<Args>(args)...);
+        rebind(alive);
+        if (_observed->size() != before_size)
+        {
+            _on_insert(*_observed, it);
+            _on_change(*_observed);
+        }
+        return iterator(*this, it);
+    }
+
+    std::pair<iterator, bool> insert
+    (const value_type& value)
+    {
+        auto alive = alive_elements();
+        auto ret = _observed->insert(value);
+        rebind(alive);
+        if (ret.second)
+        {
+            _on_insert(*_observed, ret.first);
+            _on_change(*_observed);
+        }
+        return std::make_pair(iterator(*this, ret.first), ret.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        auto alive = alive_elements();
+        auto ret = _observed->insert(std::move(value));
+        rebind(alive);
+        if (ret.second)
+        {
+            _on_insert(*_observed, ret.first);
+            _on_change(*_observed);
+        }
+        return std::make_pair(iterator(*this, ret.first), ret.second);
+    }
+
+    iterator insert(const_iterator hint,
+                    const value_type& value)
+    {
+        auto before_size = _observed->size();
+        auto alive = alive_elements();
+        auto it = _observed->insert(hint, value);
+        rebind(alive);
+        if (_observed->size() != before_size)
+        {
+            _on_insert(*_observed, it);
+            _on_change(*_observed);
+        }
+        return iterator(*this, it);
+    }
+
+    template<typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        auto before_size = _observed->size();
+        auto alive = alive_elements();
+        _observed->insert(first, last);
+        rebind(alive);
+        if (_observed->size() != before_size)
+        {
+            _on_insert(*_observed, const_iterator{});
+            _on_change(*_observed);
+        }
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    { insert(ilist.begin(), ilist.end()); }
+
+    void swap(Observed& other)
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->swap(other);
+        //the elements, and their observables, go to other
+        _it2observable.clear();
+        _on_insert(*_observed, const_iterator{});
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    size_type count
+    (const key_type& key) const noexcept
+    { return _observed->count(key); }
+
+    iterator find(const key_type& key)
+    { return iterator(*this, _observed->find(key)); }
+
+    const_iterator find
+    (const key_type& key) const
+    { return _observed->find(key); }
+
+    std::pair<iterator, iterator> equal_range
+    (const key_type& key)
+    {
+        auto p = _observed->equal_range(key);
+        return std::make_pair(iterator(*this, p.first),
+                              iterator(*this, p.second));
+    }
+
+    std::pair<const_iterator,
+              const_iterator> equal_range
+    (const key_type& key) const
+    { return _observed->equal_range(key); }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _on_value_change, _before_erase;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
+private:
+    /// Alive observable of an element before an operation that may
+    /// move the elements
+    struct alive_element
+    {
+        key_type key;
+        const_pointer address;
+        std::shared_ptr<reference> observable;
+    };
+
+    std::vector<alive_element> alive_elements() const
+    {
+        std::vector<alive_element> alive;
+        for (auto& p : _it2observable)
+            if (auto observable = p.second.lock())
+                alive.push_back(alive_element{p.first->first, p.first,
+                                              std::move(observable)});
+        return alive;
+    }
+
+    /// Rebuilds the observables of the elements that have moved for
+    /// their new addresses and drops the ones of the erased elements.
+    void rebind(const std::vector<alive_element>& alive)
+    {
+        using moved_t = std::pair<const alive_element*,
+                                  typename Observed::iterator>;
+        std::vector<moved_t> moved;
+        for (auto& e : alive)
+        {
+            auto it = _observed->find(e.key);
+            if (it != _observed->end() && &*it == e.address) continue;
+            _it2observable.erase(e.address);
+            if (it != _observed->end()) moved.emplace_back(&e, it);
+        }
+        //the new addresses may be the old ones of other elements, so
+        //they are indexed after all the old ones are dropped
+        for (auto& m : moved)
+        {
+            auto& o = *m.first->observable;
+            reference fresh(observable_factory(m.second->second));
+            detail::access::on_change(fresh) =
+                std::move(detail::access::on_change(o));
+            o = std::move(fresh);
+            _it2observable[&*m.second] = m.first->observable;
+        }
+    }
+
+    void notify_value_change(typename Observed::iterator it)
+    {
+        auto oit = _it2observable.find(&*it);
+        if (oit != _it2observable.end())
+            if (auto observable = oit->second.lock())
+            {
+                //the observable of the element notifies the container
+                detail::access::on_change(*observable)(it->second);
+                return;
+            }
+        _on_value_change(*_observed, it);
+        _on_change(*_observed);
+    }
+
+    std::shared_ptr<reference> get_reference(typename Observed::iterator it)
+    {
+        auto observable = _it2observable[&*it].lock();
+        if (!observable)
+        {
+            auto& it2observable = _it2observable;
+            auto observed = _observed;
+            auto key = it->first;
+            //the element may have moved since the observable was
+            //created, so its entry is looked up by the key
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(it->second)),
+                 [&it2observable, observed, key]
+                 {
+                     auto it = observed->find(key);
+                     if (it == observed->end()) return;
+                     auto oit = it2observable.find(&*it);
+                     if (oit != it2observable.end() && oit->second.expired())
+                         it2observable.erase(oit);
+                 });
+            auto& container = *this;
+            detail::access::on_change(*observable).connect(
+                [&container, key](const mapped_type&)
+                {
+                    container._on_value_change
+                        (container.get(), container.get().find(key));
+                    container._on_change(container.get());
+                });
+            it2observable[&*it] = observable;
+        }
+        return observable;
+    }
+    friend class flat_map_iterator<flat_map<Observed>>;
+};
+
+}
@@ -0,0 +1,235 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/detail/member_mask.hpp"
+#include "observable/detail/type_list.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <boost/fusion/include/for_each.hpp>
+#include <boost/optional.hpp>
+#include <boost/signals2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace observable {
+
+namespace detail {
+
+/// Member of a `lazy_class_`. It keeps a pointer to the observed
+/// member until its observable is needed.
+template<typename T, typename Enable = void>
+struct lazy_member
+{
+    using observable_type = observable_of_t<T>;
+    using Observed = typename observable_type::Observed;
+
+    lazy_member() = default;
+
+    lazy_member(Observed& observed)
+        : _source(&observed)
+    {}
+
+    observable_type make()
+    { return observable_type(observable_factory(*_source)); }
+
+    Observed* _source{nullptr};
+    boost::optional<observable_type> _observable;
+};
+
+/// A `set_get` is kept by value until the `setter_value` is needed.
+template<typename T>
+struct lazy_member<T, typename std::enable_if<is_set_get<T>::value>::type>
+{
+    using observable_type = observable_of_t<T>;
+
+    lazy_member() = default;
+
+    lazy_member(T source)
+        : _source(std::move(source))
+    {}
+
+    observable_type make()
+    { return observable_type(observable_factory(std::move(_source))); }
+
+    T _source;
+    boost::optional<observable_type> _observable;
+};
+
+}
+
+/// Observable class with the interface of `class_` that constructs
+/// the observable of a member, and connects it to the class, only
+/// when the member is used for the first time through `get<Tag>()`,
+/// `assign<Tag>()`, `modify<Tag>()` or `on_change<Tag>()`.
+///
+/// The construction of a class with many members only stores a
+/// pointer to each one of them. Changes made through a member that
+/// was never used are still notified, because using it creates its
+/// observable.
+template<typename Observed_, typename... Members>
+class lazy_class_
+{
+    using Tags = detail::type_list<typename Members::second_type...>;
+
+    using Storage = std::tuple<
+        detail::lazy_member<typename Members::first_type>...
+    >;
+
+    template<typename Tag>
+    using member_t = typename std::tuple_element<
+        detail::index_of<Tag, Tags>::value, Storage>::type;
+
+    using on_change_conns_t =
+        std::array<boost::signals2::scoped_connection, sizeof...(Members)>;
+
+    struct reconnect
+    {
+        template<typename T>
+        void operator()(T& member) const
+        {
+            std::size_t idx = _it - _parent._on_change_conns.begin();
+            if (member._observable)
+                *_it = _parent.forward(*member._observable, idx);
+            ++_it;
+        }
+
+        lazy_class_& _parent;
+        mutable typename on_change_conns_t::iterator _it;
+    };
+
+public:
+    using Observed = Observed_;
+
+    template<typename Tag>
+    using observable_t = typename member_t<Tag>::observable_type;
+
+    lazy_class_() = default;
+
+    template<typename... Observeds>
+    lazy_class_(Observed& observed,
+                Observeds&&... observeds)
+        : _observed(&observed)
+        , _members(std::forward<Observeds>(observeds)...)
+    {}
+
+    lazy_class_(lazy_class_&& rhs) noexcept
+        : _observed(rhs._observed)
+        , _members(std::move(rhs._members))
+        , _on_change(std::move(rhs._on_change))
+        , _on_member_change(std::move(rhs._on_member_change))
+    {
+        for (auto& c : rhs._on_change_conns) c.disconnect();
+        reconnect visitor{*this, _on_change_conns.begin()};
+        boost::fusion::for_each(_members, visitor);
+    }
+
+    lazy_class_& operator=(lazy_class_&& rhs) noexcept
+    {
+        for (auto& c : rhs._on_change_conns) c.disconnect();
+        for (auto& c : _on_change_conns) c.disconnect();
+        _observed = rhs._observed;
+        _members = std::move(rhs._members);
+        _on_change = std::move(rhs._on_change);
+        _on_member_change = std::move(rhs._on_member_change);
+        reconnect visitor{*this, _on_change_conns.begin()};
+        boost::fusion::for_each(_members, visitor);
+        return *this;
+    }
+
+    template<typename Tag, typename T>
+    void assign(T&& o)
+    { get<Tag>().assign(std::forward<T>(o)); }
+
+    template<typename Tag, typename F>
+    void modify(F&& f)
+    { get<Tag>().modify(std::forward<F>(f)); }
+
+    template<typename Tag>
+    observable_t<Tag>& get()
+    {
+        constexpr auto idx = detail::index_of<Tag, Tags>::value;
+        auto& member = std::get<idx>(_members);
+        if (!member._observable)
+        {
+            member._observable = member.make();
+            _on_change_conns[idx] = forward(*member._observable, idx);
+        }
+        return *member._observable;
+    }
+
+    template<typename Tag, typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return get<Tag>().on_change(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    /// See `class_::on_member_change()`
+    template<typename F>
+    boost::signals2::connection on_member_change(F&& f)
+    { return _on_member_change.connect(std::forward<F>(f)); }
+
+    /// See `class_::on_change_any()`
+    template<typename... Tags_, typename F>
+    boost::signals2::connection on_change_any(F&& f)
+    {
+        using mask_t = detail::member_mask<Tags, Tags_...>;
+        return _on_member_change.connect(
+            detail::masked_slot<typename std::decay<F>::type,
+                                typename mask_t::type>
+            {std::forward<F>(f), mask_t::get()});
+    }
+
+    template<typename Tag>
+    static constexpr std::size_t index() noexcept
+    { return detail::index_of<Tag, Tags>::value; }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+private:
+
+    template<typename Observable>
+    boost::signals2::connection forward(Observable& o, std::size_t member)
+    {
+        return o.on_change(
+            [this, member](const typename Observable::Observed&)
+            {
+                _on_member_change(get(), member);
+                _on_change(get());
+            });
+    }
+
+    Observed* _observed{nullptr};
+    Storage _members;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&, std::size_t)> _on_member_change;
+    on_change_conns_t _on_change_conns;
+
+    friend struct detail::access;
+};
+
+namespace detail {
+
+template<typename Observed, typename... Members>
+struct is_assignable_in_place<lazy_class_<Observed, Members...>>
+    : all_assignable_in_place<
+        observable_of_t<typename Members::first_type>...> {};
+
+}
+
+}
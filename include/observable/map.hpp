@@ -6,14 +6,23 @@
 
 #pragma once
 
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/interval_index.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/merge.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
 #include <boost/signals2.hpp>
 #include <boost/iterator.hpp>
 #include <boost/iterator/reverse_iterator.hpp>
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <stdexcept>
 #include <unordered_map>
+#include <vector>
 
 namespace observable { 
 
@@ -96,6 +105,8 @@ struct map
     
     map(Observed& observed)
         : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
     {}
     
     iterator begin() noexcept
@@ -167,19 +178,38 @@ struct map
         return get_reference(it);
     }
     
-    void clear() noexcept
+    /// Mutates the value mapped to `key` in place through `f` and
+    /// emits `on_value_change` and `on_change`. An observable of the
+    /// element is only notified if it's alive; no observable is
+    /// created.
+    template<typename F>
+    void modify(const key_type& key, F&& f)
+    {
+        auto it = _observed->find(key);
+        if (it == _observed->end()) throw std::out_of_range("map::modify");
+        std::forward<F>(f)(it->second);
+        notify_value_change(it);
+    }
+    
+    /// Not noexcept: the keys are copied before they are erased when
+    /// there are ranges to notify.
+    void clear()
     {
+        auto keys = range_keys(_observed->cbegin(), _observed->cend());
         _before_erase(*_observed, _observed->cend());
         _observed->clear();
         _on_erase(*_observed, const_iterator{});
+        notify_range(keys);
         _on_change(*_observed);
     }
     
     iterator erase(const_iterator pos)        
     {
+        auto keys = range_keys(pos, std::next(pos));
         _before_erase(*_observed, pos);
         auto it = _observed->erase(pos);
         _on_erase(*_observed, it);
+        notify_range(keys);
         _on_change(*_observed);
         return iterator(*this, it);
     }
@@ -187,9 +217,11 @@ struct map
     iterator erase(const_iterator first,
                    const_iterator last)        
     {
+        auto keys = range_keys(first, last);
         _before_erase(*_observed, first);
         auto it = _observed->erase(first, last);
         _on_erase(*_observed, it);
+        notify_range(keys);
         _on_change(*_observed);
         return iterator(*this, it);
     }
@@ -197,15 +229,8 @@ struct map
     size_type erase(const key_type& key)
     {
         auto rng = _observed->equal_range(key);
-        auto before_size = _observed->size();
-        _before_erase(*_observed, rng.first);
-        erase(rng.first, rng.second);
-        auto n = before_size - _observed->size();
-        if (n > 0)
-        {
-            _on_erase(*_observed, rng.second);
-            _on_change(*_observed);
-        }
+        size_type n = std::distance(rng.first, rng.second);
+        if (n > 0) erase(rng.first, rng.second);
         return n;
     }
     
@@ -216,6 +241,7 @@ struct map
         if (ret.second)
         {
             _on_insert(*_observed, ret.first);
+            notify_range(ret.first->first);
             _on_change(*_observed);
         }
         return std::make_pair(iterator(*this, ret.first), ret.second);
@@ -230,6 +256,7 @@ struct map
         if (_observed->size() != before_size)
         {
             _on_insert(*_observed, it);
+            notify_range(it->first);
             _on_change(*_observed);
         }
         return iterator(*this, it);
@@ -242,6 +269,7 @@ struct map
         if (ret.second)
         {
             _on_insert(*_observed, ret.first);
+            notify_range(ret.first->first);
             _on_change(*_observed);
         }
         return std::make_pair(iterator(*this, ret.first), ret.second);
@@ -253,6 +281,7 @@ struct map
         if (ret.second)
         {
             _on_insert(*_observed, ret.first);
+            notify_range(ret.first->first);
             _on_change(*_observed);
         }
         return std::make_pair(iterator(*this, ret.first), ret.second);
@@ -266,6 +295,7 @@ struct map
         if (_observed->size() != before_size)
         {
             _on_insert(*_observed, it);
+            notify_range(it->first);
             _on_change(*_observed);
         }
         return iterator(*this, it);
@@ -274,6 +304,24 @@ struct map
     template<typename InputIt>
     void insert(InputIt first, InputIt last)
     {
+        if (_ranges)
+        {
+            //each inserted key is notified to its ranges
+            bool inserted{false};
+            for (; first != last; ++first)
+            {
+                auto ret = _observed->insert(*first);
+                if (!ret.second) continue;
+                notify_range(ret.first->first);
+                inserted = true;
+            }
+            if (inserted)
+            {
+                _on_insert(*_observed, const_iterator{});
+                _on_change(*_observed);
+            }
+            return;
+        }
         auto before_size = _observed->size();
         _observed->insert(first, last);
         if (_observed->size() != before_size)
@@ -293,9 +341,85 @@ struct map
         //TODO: check?
         _on_insert(*_observed, const_iterator{});
         _on_erase(*_observed, const_iterator{});
+        //a key on both sides is notified once
+        auto before = range_keys(other.cbegin(), other.cend());
+        auto after = range_keys(_observed->cbegin(), _observed->cend());
+        std::vector<key_type> keys;
+        std::set_union(before.begin(), before.end(),
+                       after.begin(), after.end(),
+                       std::back_inserter(keys), _observed->key_comp());
+        notify_range(keys);
         _on_change(*_observed);
     }
 
+    /// Merges `source` into the observed map walking both sides in
+    /// one pass. The signals `before_erase`, `on_erase`, `on_insert`
+    /// and `on_value_change` are emitted for each element, an updated
+    /// value is also notified by its observable if it's alive, and
+    /// `on_change` is emitted only once at the end, followed by
+    /// `on_merge` with the change set. Two mapped values that are equal
+    /// according to `equal` aren't updated.
+    template<typename Source, typename Equal = never_equal>
+    merge_result merge(Source&& source,
+                       merge_policy policy = merge_policy::upsert,
+                       Equal equal = Equal{})
+    {
+        static_assert(std::is_same<typename std::decay<Source>::type,
+                                   Observed>::value,
+                      "source must be of the observed type");
+        merge_result ret;
+        detail::merging_guard guard(_merging);
+        auto comp = _observed->key_comp();
+        auto it = _observed->begin();
+        for (auto&& e : source)
+        {
+            while (it != _observed->end() && comp(it->first, e.first))
+            {
+                if (policy == merge_policy::replace)
+                {
+                    auto key = it->first;
+                    _before_erase(*_observed, it);
+                    it = _observed->erase(it);
+                    _on_erase(*_observed, it);
+                    notify_range(key);
+                    ++ret.erased;
+                }
+                else ++it;
+            }
+            if (it == _observed->end() || comp(e.first, it->first))
+            {
+                it = _observed->emplace_hint
+                    (it, detail::forward_element<Source>(e));
+                _on_insert(*_observed, it);
+                notify_range(it->first);
+                ++ret.inserted;
+            }
+            else if (!equal(it->second, e.second))
+            {
+                it->second = detail::forward_element<Source>(e.second);
+                notify_value_change(it);
+                ++ret.updated;
+            }
+            ++it;
+        }
+        if (policy == merge_policy::replace)
+            while (it != _observed->end())
+            {
+                auto key = it->first;
+                _before_erase(*_observed, it);
+                it = _observed->erase(it);
+                _on_erase(*_observed, it);
+                notify_range(key);
+                ++ret.erased;
+            }
+        if (ret.changed())
+        {
+            _on_change(*_observed);
+            _on_merge(*_observed, ret);
+        }
+        return ret;
+    }
+
     size_type count
     (const key_type& key) const noexcept
     { return _observed->count(key); }
@@ -319,6 +443,39 @@ struct map
               const_iterator> equal_range
     (const key_type& key) const
     { return _observed->equal_range(key); }
+
+#ifdef __cpp_lib_generic_associative_lookup
+    /// Heterogeneous lookup, available when `key_compare` is
+    /// transparent, like std::less<>.
+    template<typename K, typename C = key_compare,
+             typename = typename C::is_transparent>
+    size_type count(const K& key) const
+    { return _observed->count(key); }
+    
+    template<typename K, typename C = key_compare,
+             typename = typename C::is_transparent>
+    iterator find(const K& key)
+    { return iterator(*this, _observed->find(key)); }
+    
+    template<typename K, typename C = key_compare,
+             typename = typename C::is_transparent>
+    const_iterator find(const K& key) const
+    { return _observed->find(key); }
+    
+    template<typename K, typename C = key_compare,
+             typename = typename C::is_transparent>
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        auto p = _observed->equal_range(key);
+        return std::make_pair(iterator(*this, p.first),
+                              iterator(*this, p.second));
+    }
+    
+    template<typename K, typename C = key_compare,
+             typename = typename C::is_transparent>
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    { return _observed->equal_range(key); }
+#endif
     
     template<typename F>
     boost::signals2::connection before_erase(F&& f)
@@ -339,20 +496,85 @@ struct map
     template<typename F>
     boost::signals2::connection on_value_change(F&& f)
     { return _on_value_change.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, const merge_result&)` to the
+    /// merges that change the map. It's emitted once by `merge()`,
+    /// after `on_change`.
+    template<typename F>
+    boost::signals2::connection on_merge(F&& f)
+    { return _on_merge.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, const key_type&)` to the
+    /// insertions, erasures and value changes of the keys in the
+    /// closed range [lo, hi]. Each change is dispatched only to the
+    /// ranges that contain its key, in O(log s + k) for s boundaries
+    /// of ranges and k ranges that contain the key. An erased key is
+    /// notified after the erasure.
+    template<typename F>
+    boost::signals2::connection on_range_change
+    (const key_type& lo, const key_type& hi, F&& f)
+    {
+        if (_observed->key_comp()(hi, lo))
+            throw std::invalid_argument("map::on_range_change");
+        if (!_ranges)
+            _ranges.reset(new detail::interval_index<Observed>
+                          (_observed->key_comp()));
+        return _ranges->connect(lo, hi, std::forward<F>(f));
+    }
     
     const Observed& get() const noexcept
     { return *_observed; }
     
     Observed* _observed;
     
-    boost::signals2::signal<void(const Observed&, const_iterator)>
+    detail::lazy_signal<void(const Observed&, const_iterator)>
     _on_erase, _on_insert, _on_value_change, _before_erase;
     
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+    detail::lazy_signal<void(const Observed&, const merge_result&)>
+    _on_merge;
     
-    std::unordered_map<const_pointer,
-                       std::weak_ptr<reference>> _it2observable;
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
+
+    std::unique_ptr<detail::interval_index<Observed>> _ranges;
 private:
+    /// Raised by `merge`, which emits `on_change` only once at the end
+    bool _merging{false};
+
+    void notify_range(const key_type& key)
+    { if (_ranges) (*_ranges)(*_observed, key); }
+
+    void notify_range(const std::vector<key_type>& keys)
+    { for (auto& key : keys) notify_range(key); }
+
+    /// Keys in [first, last), which are only needed if there are
+    /// ranges to notify after the elements are gone.
+    std::vector<key_type> range_keys(const_iterator first,
+                                     const_iterator last) const
+    {
+        std::vector<key_type> keys;
+        if (_ranges)
+            for (; first != last; ++first) keys.push_back(first->first);
+        return keys;
+    }
+    
+    void notify_value_change(typename Observed::iterator it)
+    {
+        auto oit = _it2observable.find(&*it);
+        if (oit != _it2observable.end())
+            if (auto observable = oit->second.lock())
+            {
+                //the observable of the element notifies the container
+                detail::access::on_change(*observable)(it->second);
+                return;
+            }
+        _on_value_change(*_observed, it);
+        notify_range(it->first);
+        if (!_merging) _on_change(*_observed);
+    }
+    
     std::shared_ptr<reference> get_reference(typename Observed::iterator it)
     {
         auto observable = _it2observable[&*it].lock();
@@ -360,19 +582,18 @@ private:
         {
             auto& it2observable = _it2observable;
             auto it_ptr = &*it;
-            observable = std::shared_ptr<reference>
-                (new reference(observable_factory(it->second)),
-                 [&it2observable, it_ptr](reference *p)
-                 {
-                     it2observable.erase(it_ptr);
-                     delete p;
-                 });
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(it->second)),
+                 [&it2observable, it_ptr]{ it2observable.erase(it_ptr); });
             auto& container = *this;
-            observable->_on_change.connect(
+            detail::access::on_change(*observable).connect(
                 [&container, it](const typename reference::Observed&)
                 {
                     container._on_value_change(container.get(), it);
-                    container._on_change(container.get());
+                    container.notify_range(it->first);
+                    if (!container._merging)
+                        container._on_change(container.get());
                 });
             it2observable[&*it] = observable;
         }
@@ -0,0 +1,70 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/equal.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace observable {
+
+/// Says what `merge` does with the elements of the observed
+/// container whose keys aren't present in the source.
+enum class merge_policy
+{
+    /// Insert the new keys and update the existing ones. The other
+    /// elements are kept.
+    upsert,
+    
+    /// Like `upsert`, but the elements whose keys aren't present in
+    /// the source are erased.
+    replace
+};
+
+/// Change set of a merge.
+struct merge_result
+{
+    std::size_t inserted{0};
+    std::size_t updated{0};
+    std::size_t erased{0};
+
+    bool changed() const noexcept
+    { return inserted + updated + erased > 0; }
+};
+
+namespace detail {
+
+/// Moves `o` if `Source` is a rvalue and copies it otherwise.
+template<typename Source, typename T>
+inline typename std::conditional<
+    std::is_lvalue_reference<Source>::value,
+    T&,
+    typename std::remove_reference<T>::type&&
+>::type
+forward_element(T& o) noexcept
+{
+    return static_cast<typename std::conditional<
+        std::is_lvalue_reference<Source>::value,
+        T&,
+        typename std::remove_reference<T>::type&&>::type>(o);
+}
+
+/// Raises the flag of a container that is merging a source while it
+/// lives.
+struct merging_guard
+{
+    explicit merging_guard(bool& merging) noexcept
+        : merging(merging)
+    { merging = true; }
+
+    ~merging_guard()
+    { merging = false; }
+
+    bool& merging;
+};
+    
+}}
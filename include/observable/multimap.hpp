@@ -0,0 +1,284 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/map.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+#include <boost/iterator/reverse_iterator.hpp>
+#include <memory>
+
+namespace observable {
+
+template<typename Observed_>
+struct multimap;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_multimap<Observed>::value>::type
+>
+{
+    using type = multimap<Observed>;
+};
+
+/// Observable of a `std::multimap`. It has the signals of `map` and
+/// the iteration yields observables of the mapped values, but every
+/// insertion inserts and there is no access by key.
+template<typename Observed_>
+struct multimap
+{
+    using Observed = Observed_;
+
+    using key_type = typename Observed::key_type;
+    using mapped_type = typename Observed::mapped_type;
+    using value_type = typename Observed::value_type;
+    using key_compare = typename Observed::key_compare;
+    using reference = observable_of_t<typename Observed::mapped_type>;
+    using const_reference = typename Observed::const_reference;
+    using pointer = reference*;
+    using const_pointer = typename Observed::const_pointer;
+    using iterator = map_iterator<multimap<Observed>>;
+    using reverse_iterator = boost::reverse_iterator<iterator>;
+    using const_iterator = typename Observed::const_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    multimap() = default;
+
+    multimap(Observed& observed)
+        : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
+    {}
+
+    iterator begin() noexcept
+    { return iterator(*this, _observed->begin()); }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator
+            (iterator(*this, _observed->end()));
+    }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    const_reverse_iterator crbegin() noexcept
+    { return _observed->crbegin(); }
+
+    iterator end() noexcept
+    { return iterator(*this, _observed->end()); }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator
+            (iterator(*this, _observed->begin()));
+    }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    const_reverse_iterator crend() noexcept
+    { return _observed->crend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    void clear() noexcept
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->clear();
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        _before_erase(*_observed, pos);
+        auto it = _observed->erase(pos);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    iterator erase(const_iterator first,
+                   const_iterator last)
+    {
+        _before_erase(*_observed, first);
+        auto it = _observed->erase(first, last);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto rng = _observed->equal_range(key);
+        if (rng.first == rng.second) return 0;
+        auto before_size = _observed->size();
+        erase(rng.first, rng.second);
+        return before_size - _observed->size();
+    }
+
+    template<typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        auto it = _observed->emplace(std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    template<typename... Args>
+    iterator emplace_hint
+    (const_iterator hint, Args&&... args)
+    {
+        auto it = _observed->emplace_hint(hint, std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    iterator insert(const value_type& value)
+    { return emplace(value); }
+
+    iterator insert(value_type&& value)
+    { return emplace(std::move(value)); }
+
+    iterator insert(const_iterator hint,
+                    const value_type& value)
+    { return emplace_hint(hint, value); }
+
+    template<typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if (first == last) return;
+        _observed->insert(first, last);
+        _on_insert(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    { insert(ilist.begin(), ilist.end()); }
+
+    void swap(Observed& other)
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->swap(other);
+        _on_insert(*_observed, const_iterator{});
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    size_type count
+    (const key_type& key) const
+    { return _observed->count(key); }
+
+    iterator find(const key_type& key)
+    { return iterator(*this, _observed->find(key)); }
+
+    const_iterator find
+    (const key_type& key) const
+    { return _observed->find(key); }
+
+    std::pair<iterator, iterator> equal_range
+    (const key_type& key)
+    {
+        auto p = _observed->equal_range(key);
+        return std::make_pair(iterator(*this, p.first),
+                              iterator(*this, p.second));
+    }
+
+    std::pair<const_iterator,
+              const_iterator> equal_range
+    (const key_type& key) const
+    { return _observed->equal_range(key); }
+
+    iterator lower_bound(const key_type& key)
+    { return iterator(*this, _observed->lower_bound(key)); }
+
+    const_iterator lower_bound(const key_type& key) const
+    { return _observed->lower_bound(key); }
+
+    iterator upper_bound(const key_type& key)
+    { return iterator(*this, _observed->upper_bound(key)); }
+
+    const_iterator upper_bound(const key_type& key) const
+    { return _observed->upper_bound(key); }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _on_value_change, _before_erase;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
+private:
+    std::shared_ptr<reference> get_reference(typename Observed::iterator it)
+    {
+        auto observable = _it2observable[&*it].lock();
+        if (!observable)
+        {
+            auto& it2observable = _it2observable;
+            auto it_ptr = &*it;
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(it->second)),
+                 [&it2observable, it_ptr]{ it2observable.erase(it_ptr); });
+            auto& container = *this;
+            detail::access::on_change(*observable).connect(
+                [&container, it](const typename reference::Observed&)
+                {
+                    container._on_value_change(container.get(), it);
+                    container._on_change(container.get());
+                });
+            it2observable[&*it] = observable;
+        }
+        return observable;
+    }
+    friend class map_iterator<multimap<Observed>>;
+};
+
+}
@@ -0,0 +1,245 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+
+namespace observable {
+
+template<typename Observed_>
+struct multiset;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_multiset<Observed>::value>::type
+>
+{
+    using type = multiset<Observed>;
+};
+
+/// Observable of a `std::multiset`. It has the interface and the
+/// signals of `set`, but every insertion inserts.
+template<typename Observed_>
+struct multiset
+{
+    using Observed = Observed_;
+
+    using key_type = typename Observed::key_type;
+    using value_type = typename Observed::value_type;
+    using key_compare = typename Observed::key_compare;
+    using value_compare = typename Observed::value_compare;
+    using reference = typename Observed::reference;
+    using const_reference = typename Observed::const_reference;
+    using pointer = typename Observed::pointer;
+    using const_pointer = typename Observed::const_pointer;
+    using iterator = typename Observed::iterator;
+    using const_iterator = typename Observed::const_iterator;
+    using reverse_iterator = typename Observed::reverse_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    multiset() = default;
+
+    multiset(Observed& observed)
+        : _observed(&observed)
+    {}
+
+    iterator begin() noexcept
+    { return _observed->begin(); }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    reverse_iterator rbegin() noexcept
+    { return _observed->rbegin(); }
+
+    const_reverse_iterator crbegin() const noexcept
+    { return _observed->crbegin(); }
+
+    iterator end() noexcept
+    { return _observed->end(); }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    reverse_iterator rend() noexcept
+    { return _observed->rend(); }
+
+    const_reverse_iterator crend() const noexcept
+    { return _observed->crend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    void clear() noexcept
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->clear();
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        _before_erase(*_observed, pos);
+        auto it = _observed->erase(pos);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    iterator erase(const_iterator first,
+                   const_iterator last)
+    {
+        _before_erase(*_observed, first);
+        auto it = _observed->erase(first, last);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto rng = _observed->equal_range(key);
+        if (rng.first == rng.second) return 0;
+        auto before_size = _observed->size();
+        erase(rng.first, rng.second);
+        return before_size - _observed->size();
+    }
+
+    template<typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        auto it = _observed->emplace(std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    template<typename... Args>
+    iterator emplace_hint
+    (const_iterator hint, Args&&... args)
+    {
+        auto it = _observed->emplace_hint(hint, std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return it;
+    }
+
+    iterator insert
+    (const value_type& value)
+    { return emplace(value); }
+
+    iterator insert
+    (value_type&& value)
+    { return emplace(std::move(value)); }
+
+    iterator insert
+    (const_iterator hint,
+     const value_type& value)
+    { return emplace_hint(hint, value); }
+
+    iterator insert
+    (const_iterator hint,
+     value_type&& value)
+    { return emplace_hint(hint, std::move(value)); }
+
+    template<typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if (first == last) return;
+        _observed->insert(first, last);
+        _on_insert(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    { insert(ilist.begin(), ilist.end()); }
+
+    void swap(Observed& other)
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->swap(other);
+        _on_insert(*_observed, const_iterator{});
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    size_type count
+    (const key_type& key) const
+    { return _observed->count(key); }
+
+    iterator find
+    (const key_type& key)
+    { return _observed->find(key); }
+
+    const_iterator find
+    (const key_type& key) const
+    { return _observed->find(key); }
+
+    std::pair<iterator,
+              iterator> equal_range
+    (const key_type& key)
+    { return _observed->equal_range(key); }
+
+    std::pair<const_iterator,
+              const_iterator> equal_range
+    (const key_type& key) const
+    { return _observed->equal_range(key); }
+
+    iterator lower_bound(const key_type& key)
+    { return _observed->lower_bound(key); }
+
+    const_iterator lower_bound(const key_type& key) const
+    { return _observed->lower_bound(key); }
+
+    iterator upper_bound(const key_type& key)
+    { return _observed->upper_bound(key); }
+
+    const_iterator upper_bound(const key_type& key) const
+    { return _observed->upper_bound(key); }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _before_erase;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+};
+
+}
@@ -42,3 +42,24 @@
 #define OBSERVABLE_CLASS_GEN(oclass, observed, members) \
     OBSERVABLE_gen_tags(members) \
     using oclass = OBSERVABLE_gen_oclass(observed, members);
+
+#define OBSERVABLE_gen_owning_oclass(members) \
+    ::observable::owning_class_<OBSERVABLE_gen_members(members)>
+
+/// Generates the tags of `members` and an `owning_class_` named
+/// `oclass` that stores them. There is no model type: the fields live
+/// inside of the observable.
+#define OBSERVABLE_OWNING_CLASS_GEN(oclass, members) \
+    OBSERVABLE_gen_tags(members) \
+    using oclass = OBSERVABLE_gen_owning_oclass(members);
+
+#define OBSERVABLE_gen_lazy_oclass(observed, members) \
+    ::observable::lazy_class_<                      \
+        observed, OBSERVABLE_gen_members(members) \
+    >
+
+/// Like `OBSERVABLE_CLASS_GEN`, but generates a `lazy_class_`, which
+/// only constructs the observable of a member when it's used.
+#define OBSERVABLE_LAZY_CLASS_GEN(oclass, observed, members) \
+    OBSERVABLE_gen_tags(members) \
+    using oclass = OBSERVABLE_gen_lazy_oclass(observed, members);
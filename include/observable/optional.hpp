@@ -0,0 +1,265 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/equal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/optional.hpp>
+#include <boost/signals2.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+namespace observable {
+
+template<typename Observed_, typename Equal_ = never_equal>
+struct optional;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_optional<Observed>::value>::type
+>
+{
+    using type = optional<Observed>;
+};
+
+/// Observable of a `boost::optional` or a `std::optional`.
+///
+/// While the optional is engaged, its value is observed by an
+/// observable of the type of the value, which is created by each
+/// engagement and destroyed by each disengagement. The slots of its
+/// `on_change` are kept while the optional is disengaged and are moved
+/// to the observable of the next engagement. Changes through the
+/// observable of the value are notified by `on_change` of the
+/// optional.
+///
+/// An assignment that engages the optional emits `on_engage`, one
+/// that disengages it emits `on_disengage` and one that keeps it
+/// engaged emits only `on_change` of the observable of the value:
+/// when the value is a `class_`, the slots connected to its members
+/// aren't executed. All of them emit `on_change`. An assignment that
+/// keeps the optional engaged keeps the observable of the value if
+/// it's still valid for the value assigned in place, like a `value`.
+/// Otherwise, when it has nested observables like the ones of a
+/// `variant` or a container, it's rebuilt like by a disengagement
+/// followed by an engagement.
+template<typename Observed_, typename Equal_>
+struct optional
+{
+    using Observed = Observed_;
+    using Equal = Equal_;
+    using value_type = typename Observed::value_type;
+    using observable_value_t = observable_of_t<value_type>;
+    using value_signal_t = typename std::decay<
+        decltype(detail::access::on_change(
+                     std::declval<observable_value_t&>()))>::type;
+
+    optional() = default;
+
+    optional(Observed& observed)
+        : _observed(&observed)
+    { if (*_observed) engage(); }
+
+    optional(optional&& rhs) noexcept
+        : _observed(rhs._observed)
+        , _on_change(std::move(rhs._on_change))
+        , _on_engage(std::move(rhs._on_engage))
+        , _on_disengage(std::move(rhs._on_disengage))
+    { move_value(rhs); }
+
+    template<typename E>
+    optional(optional<Observed, E>&& rhs) noexcept
+        : _observed(rhs._observed)
+        , _on_change(std::move(rhs._on_change))
+        , _on_engage(std::move(rhs._on_engage))
+        , _on_disengage(std::move(rhs._on_disengage))
+    { move_value(rhs); }
+
+    optional& operator=(optional&& rhs) noexcept
+    {
+        _observed = rhs._observed;
+        _on_change = std::move(rhs._on_change);
+        _on_engage = std::move(rhs._on_engage);
+        _on_disengage = std::move(rhs._on_disengage);
+        move_value(rhs);
+        return *this;
+    }
+
+    template<typename T>
+    optional& operator=(T&& o)
+    {
+        assign(std::forward<T>(o));
+        return *this;
+    }
+
+    void assign(const Observed& o)
+    {
+        if (Equal{}(*_observed, o)) return;
+        bool engaged = has_value();
+        *_observed = o;
+        on_assign(engaged);
+    }
+
+    void assign(Observed&& o)
+    {
+        if (Equal{}(*_observed, o)) return;
+        bool engaged = has_value();
+        *_observed = std::move(o);
+        on_assign(engaged);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        bool engaged = has_value();
+        _observed->emplace(std::forward<Args>(args)...);
+        on_assign(engaged);
+    }
+
+    void reset()
+    {
+        if (!has_value()) return;
+        *_observed = Observed();
+        on_assign(true);
+    }
+
+    bool has_value() const noexcept
+    { return bool(*_observed); }
+
+    explicit operator bool() const noexcept
+    { return has_value(); }
+
+    /// Observable of the value. The optional must be engaged.
+    observable_value_t& operator*() noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return *_value;
+    }
+
+    observable_value_t* operator->() noexcept
+    {
+        BOOST_ASSERT(has_value());
+        return &*_value;
+    }
+
+    observable_value_t& value()
+    {
+        if (!has_value()) throw std::out_of_range("optional::value");
+        return *_value;
+    }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_engage(F&& f)
+    { return _on_engage.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_disengage(F&& f)
+    { return _on_disengage.connect(std::forward<F>(f)); }
+
+    Observed* _observed{nullptr};
+
+    detail::lazy_signal<void(const Observed&)>
+    _on_change, _on_engage, _on_disengage;
+
+    boost::optional<observable_value_t> _value;
+    boost::signals2::scoped_connection _value_conn;
+
+    /// Slots of `on_change` of the observable of the value while the
+    /// optional is disengaged
+    value_signal_t _value_slots;
+private:
+    void engage()
+    {
+        _value.emplace(observable_factory(**_observed));
+        detail::access::on_change(*_value) = std::move(_value_slots);
+        forward_value_changes();
+    }
+
+    void disengage()
+    {
+        _value_conn.disconnect();
+        _value_slots = std::move(detail::access::on_change(*_value));
+        _value = boost::none;
+    }
+
+    void refresh_value(std::true_type)
+    {}
+
+    void refresh_value(std::false_type)
+    {
+        disengage();
+        engage();
+    }
+
+    void forward_value_changes()
+    {
+        auto& self = *this;
+        _value_conn = _value->on_change(
+            [&self](const value_type&)
+            { self._on_change(self.get()); });
+    }
+
+    template<typename E>
+    void move_value(optional<Observed, E>& rhs)
+    {
+        rhs._value_conn.disconnect();
+        _value = std::move(rhs._value);
+        rhs._value = boost::none;
+        _value_slots = std::move(rhs._value_slots);
+        if (_value) forward_value_changes();
+    }
+
+    void on_assign(bool engaged)
+    {
+        if (!has_value())
+        {
+            if (engaged)
+            {
+                disengage();
+                _on_disengage(*_observed);
+            }
+        }
+        else if (engaged)
+        {
+            refresh_value(std::integral_constant<
+                bool,
+                detail::is_assignable_in_place<observable_value_t>::value>{});
+            //the observable of the value notifies the optional, but
+            //not the observables of its members
+            detail::access::on_change(*_value)(**_observed);
+            return;
+        }
+        else
+        {
+            engage();
+            _on_engage(*_observed);
+        }
+        _on_change(*_observed);
+    }
+
+    template<typename, typename>
+    friend struct optional;
+};
+
+template<typename Observed, typename E, typename Equal>
+struct with_equal<optional<Observed, E>, Equal>
+{ using type = optional<Observed, Equal>; };
+
+}
@@ -0,0 +1,83 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/equal.hpp"
+
+#include <boost/signals2.hpp>
+
+#include <utility>
+
+namespace observable {
+
+/// Observable that stores the observed value instead of referring to
+/// it. It has the same interface of `value`, but `get()` reads the
+/// value that lives right next to the signal.
+template<typename Observed_, typename Equal_ = never_equal>
+struct owned_value
+{
+    using Observed = Observed_;
+    using Equal = Equal_;
+
+    owned_value() = default;
+
+    explicit owned_value(Observed o)
+        : _observed(std::move(o))
+    {
+    }
+
+    owned_value(owned_value&&) = default;
+    owned_value& operator=(owned_value&&) = default;
+
+    template<typename T>
+    owned_value& operator=(T&& o)
+    {
+        assign(std::forward<T>(o));
+        return *this;
+    }
+
+    void assign(const Observed& o)
+    {
+        if (Equal{}(_observed, o)) return;
+        _observed = o;
+        _on_change(_observed);
+    }
+
+    void assign(Observed&& o)
+    {
+        if (Equal{}(_observed, o)) return;
+        _observed = std::move(o);
+        _on_change(_observed);
+    }
+
+    /// Mutates the observed value in place through `f` and emits
+    /// `on_change`. The equality policy isn't used.
+    template<typename F>
+    void modify(F&& f)
+    {
+        std::forward<F>(f)(_observed);
+        _on_change(_observed);
+    }
+
+    const Observed& get() const noexcept
+    { return _observed; }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    {
+        return _on_change.connect(std::forward<F>(f));
+    }
+
+    Observed _observed;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+};
+
+template<typename Observed, typename E, typename Equal>
+struct with_equal<owned_value<Observed, E>, Equal>
+{ using type = owned_value<Observed, Equal>; };
+
+}
@@ -0,0 +1,210 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/detail/member_mask.hpp"
+#include "observable/detail/type_list.hpp"
+#include "observable/owned_value.hpp"
+#include "observable/types.hpp"
+
+#include <boost/fusion/adapted/std_tuple.hpp>
+#include <boost/fusion/include/for_each.hpp>
+#include <boost/signals2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace observable {
+
+namespace detail {
+
+/// Storage of a member of `owning_class_` whose observable is a
+/// proxy. The observed object lives right before its proxy, which
+/// refers to it.
+template<typename Observable>
+struct owned_member
+{
+    using observable_type = Observable;
+    using Observed = typename Observable::Observed;
+
+    owned_member()
+        : _observable(observable_factory(_storage))
+    {}
+
+    owned_member(Observed o)
+        : _storage(std::move(o))
+        , _observable(observable_factory(_storage))
+    {}
+
+    owned_member(const owned_member&) = delete;
+    owned_member& operator=(const owned_member&) = delete;
+
+    observable_type& observable() noexcept
+    { return _observable; }
+
+    const observable_type& observable() const noexcept
+    { return _observable; }
+
+    Observed _storage;
+    observable_type _observable;
+};
+
+/// A member observed by `value` is stored inline by an `owned_value`.
+template<typename T, typename Equal>
+struct owned_member<value<T, Equal>>
+{
+    using observable_type = owned_value<T, Equal>;
+
+    owned_member() = default;
+
+    owned_member(T o)
+        : _observable(std::move(o))
+    {}
+
+    owned_member(const owned_member&) = delete;
+    owned_member& operator=(const owned_member&) = delete;
+
+    observable_type& observable() noexcept
+    { return _observable; }
+
+    const observable_type& observable() const noexcept
+    { return _observable; }
+
+    observable_type _observable;
+};
+
+}
+
+/// Observable class that owns its members.
+///
+/// The members are stored inline next to their signals, so the
+/// object and its notifications live in the same allocation and
+/// `get<Tag>().get()` doesn't chase a pointer to reach a member whose
+/// observable is a `value`. The members of other kinds are stored
+/// right before the proxy that manipulates them.
+///
+/// The proxies refer to the storage of the object, so an
+/// `owning_class_` can't be copied or moved. It's constructed in
+/// place from the values of the members in the order of `Members`.
+template<typename... Members>
+class owning_class_
+{
+    using Tags = detail::type_list<typename Members::second_type...>;
+
+    using Storage = std::tuple<
+        detail::owned_member<observable_of_t<typename Members::first_type>>...
+    >;
+
+    template<typename Tag>
+    using member_t = typename std::tuple_element<
+        detail::index_of<Tag, Tags>::value, Storage>::type;
+
+    struct set_on_change
+    {
+        template<typename T>
+        void operator()(T& member) const
+        {
+            auto& parent = _parent;
+            std::size_t idx = _it - parent._on_change_conns.begin();
+            *_it++ = member.observable().on_change(
+                [&parent, idx](const typename T::observable_type::Observed&)
+                {
+                    parent._on_change(parent);
+                    parent._on_member_change(parent, idx);
+                });
+        }
+
+        owning_class_& _parent;
+        mutable typename std::array<boost::signals2::scoped_connection,
+                           sizeof...(Members)>::iterator _it;
+    };
+
+public:
+    using Observed = owning_class_;
+
+    template<typename Tag>
+    using observable_t = typename member_t<Tag>::observable_type;
+
+    owning_class_()
+    { connect_members(); }
+
+    template<typename... Ts,
+             typename = typename std::enable_if<
+                 sizeof...(Ts) == sizeof...(Members)>::type>
+    explicit owning_class_(Ts&&... members)
+        : _members(std::forward<Ts>(members)...)
+    { connect_members(); }
+
+    owning_class_(const owning_class_&) = delete;
+    owning_class_& operator=(const owning_class_&) = delete;
+
+    template<typename Tag, typename T>
+    void assign(T&& o)
+    { get<Tag>().assign(std::forward<T>(o)); }
+
+    template<typename Tag, typename F>
+    void modify(F&& f)
+    { get<Tag>().modify(std::forward<F>(f)); }
+
+    template<typename Tag>
+    observable_t<Tag>& get() noexcept
+    { return std::get<detail::index_of<Tag, Tags>::value>(_members).observable(); }
+
+    template<typename Tag>
+    const observable_t<Tag>& get() const noexcept
+    { return std::get<detail::index_of<Tag, Tags>::value>(_members).observable(); }
+
+    template<typename Tag, typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return get<Tag>().on_change(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    /// See `class_::on_member_change()`
+    template<typename F>
+    boost::signals2::connection on_member_change(F&& f)
+    { return _on_member_change.connect(std::forward<F>(f)); }
+
+    /// See `class_::on_change_any()`
+    template<typename... Tags_, typename F>
+    boost::signals2::connection on_change_any(F&& f)
+    {
+        using mask_t = detail::member_mask<Tags, Tags_...>;
+        return _on_member_change.connect(
+            detail::masked_slot<typename std::decay<F>::type,
+                                typename mask_t::type>
+            {std::forward<F>(f), mask_t::get()});
+    }
+
+    template<typename Tag>
+    static constexpr std::size_t index() noexcept
+    { return detail::index_of<Tag, Tags>::value; }
+
+    const Observed& get() const noexcept
+    { return *this; }
+
+private:
+
+    void connect_members()
+    {
+        set_on_change visitor{*this, _on_change_conns.begin()};
+        boost::fusion::for_each(_members, visitor);
+    }
+
+    Storage _members;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&, std::size_t)> _on_member_change;
+    std::array<boost::signals2::scoped_connection, sizeof...(Members)>
+        _on_change_conns;
+};
+
+}
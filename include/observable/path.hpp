@@ -0,0 +1,312 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/vector.hpp"
+
+#include <boost/signals2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace observable {
+
+/// Step of a path that matches any element of a vector
+struct any {};
+
+/// Concrete path of a change: the position of the member for each tag
+/// and the index of the element for each `any`.
+using path_t = std::vector<std::size_t>;
+
+namespace detail {
+
+/// State shared by the slots of a path. It owns the connections made
+/// to the observables of the elements, which are made after
+/// `on_path_change()` returns and are closed by `disconnect()`.
+struct path_state_base
+{
+    void keep(boost::signals2::connection conn)
+    {
+        elements.erase(
+            std::remove_if(elements.begin(), elements.end(),
+                           [](const boost::signals2::scoped_connection& c)
+                           { return !c.connected(); }),
+            elements.end());
+        elements.emplace_back(std::move(conn));
+    }
+
+    void disconnect()
+    {
+        connected = false;
+        elements.clear();
+    }
+
+    bool connected{true};
+    std::vector<boost::signals2::scoped_connection> elements;
+};
+
+template<typename F>
+struct path_state : path_state_base
+{
+    path_state(F f)
+        : f(std::move(f))
+    {}
+
+    F f;
+};
+
+/// Path resolved up to a step. It's called when a change is notified,
+/// so the index of an element is computed from the address of the
+/// element and the vector that holds it at that time.
+using path_prefix = std::function<path_t()>;
+
+inline path_prefix append(path_prefix prefix, std::size_t position)
+{
+    return [prefix, position]
+    {
+        auto path = prefix();
+        path.push_back(position);
+        return path;
+    };
+}
+
+template<typename Observed>
+inline path_prefix append(path_prefix prefix,
+                          const Observed* container,
+                          const typename Observed::value_type* element)
+{
+    return [prefix, container, element]
+    {
+        auto path = prefix();
+        path.push_back(element - container->data());
+        return path;
+    };
+}
+
+/// Positions of the members of the path until its end or the next
+/// `any`, which are reported for a change to a whole element.
+template<typename Observable, typename... Steps>
+struct path_tail
+{
+    static void append(path_t&) {}
+};
+
+template<typename Observable, typename Tag, typename... Steps>
+struct path_tail<Observable, Tag, Steps...>
+{
+    using member_t = typename std::decay<
+        decltype(std::declval<Observable&>().template get<Tag>())>::type;
+
+    static void append(path_t& path)
+    {
+        path.push_back(Observable::template index<Tag>());
+        path_tail<member_t, Steps...>::append(path);
+    }
+};
+
+template<typename Observable, typename... Steps>
+struct path_tail<Observable, any, Steps...>
+{
+    static void append(path_t&) {}
+};
+
+/// Element of a vector whose member is changing. It's marked by the
+/// signal of the changes to the members of the element, which is
+/// emitted before the element notifies the vector.
+struct element_mark
+{
+    const void* element{nullptr};
+};
+
+struct mark_element
+{
+    template<typename... Args>
+    void operator()(const Args&...) const
+    { mark->element = element; }
+
+    std::shared_ptr<element_mark> mark;
+    const void* element;
+};
+
+template<typename Observable>
+inline boost::signals2::connection
+on_member_change(Observable& o, mark_element f)
+{ return o.on_member_change(std::move(f)); }
+
+template<typename Observed>
+inline boost::signals2::connection
+on_member_change(vector<Observed>& o, mark_element f)
+{ return o.on_value_change(std::move(f)); }
+
+template<typename... Steps>
+struct path_resolver;
+
+/// End of the path: the observable reached by the path has changed.
+template<>
+struct path_resolver<>
+{
+    template<typename Observable, typename State>
+    static boost::signals2::connection connect
+    (Observable& o, const std::shared_ptr<State>& state, path_prefix prefix)
+    {
+        return o.on_change(
+            [state, prefix](const typename Observable::Observed&)
+            { if (state->connected) state->f(prefix()); });
+    }
+};
+
+/// The member `Tag` of a class is resolved at once.
+template<typename Tag, typename... Steps>
+struct path_resolver<Tag, Steps...>
+{
+    template<typename Observable, typename State>
+    static boost::signals2::connection connect
+    (Observable& o, const std::shared_ptr<State>& state, path_prefix prefix)
+    {
+        return path_resolver<Steps...>::connect
+            (o.template get<Tag>(), state,
+             append(std::move(prefix), Observable::template index<Tag>()));
+    }
+};
+
+/// A path ending at any element reacts to `on_value_change`, which is
+/// also emitted for changes made without an observable of the
+/// element, like `vector::modify()`.
+template<>
+struct path_resolver<any>
+{
+    template<typename Observed, typename State>
+    static boost::signals2::connection connect
+    (vector<Observed>& o, const std::shared_ptr<State>& state,
+     path_prefix prefix)
+    {
+        return o.on_value_change(
+            [state, prefix](const Observed& c,
+                            typename Observed::const_iterator it)
+            {
+                if (!state->connected) return;
+                auto path = prefix();
+                path.push_back(it - c.begin());
+                state->f(path);
+            });
+    }
+};
+
+/// The rest of the path after any element is attached to the
+/// observables of the elements that are alive and to the ones that
+/// will be created. The connections belong to the signals of each
+/// element, so they don't extend its lifetime, and are kept by the
+/// state of the path to be closed by its `disconnect()`.
+///
+/// A change to a whole element, like the ones of `vector::modify()`,
+/// doesn't go through the members of the element, so it's caught by
+/// `on_value_change` of the vector and reported with the positions of
+/// the members of the path up to its end or the next `any`. A change
+/// to a member marks the element before the vector is notified, and
+/// then it's only reported if the member is in the path.
+template<typename... Steps>
+struct path_resolver<any, Steps...>
+{
+    template<typename Observed, typename State>
+    static boost::signals2::connection connect
+    (vector<Observed>& o, const std::shared_ptr<State>& state,
+     path_prefix prefix)
+    {
+        using reference = typename vector<Observed>::reference;
+        const Observed* container = o._observed;
+        auto mark = std::make_shared<element_mark>();
+        for (auto& p : o._it2observable)
+            if (auto element = p.second.lock())
+                attach(container, *element, state, prefix, mark);
+        state->keep(o.on_reference(
+            [container, state, prefix, mark](reference& element)
+            { attach(container, element, state, prefix, mark); }));
+        return o.on_value_change(
+            [state, prefix, mark]
+            (const Observed& c, typename Observed::const_iterator it)
+            {
+                auto marked = mark->element;
+                mark->element = nullptr;
+                if (!state->connected || marked == &*it) return;
+                auto path = prefix();
+                path.push_back(it - c.begin());
+                path_tail<reference, Steps...>::append(path);
+                state->f(path);
+            });
+    }
+
+private:
+
+    template<typename Observed, typename State>
+    static void attach(const Observed* container,
+                       typename vector<Observed>::reference& element,
+                       const std::shared_ptr<State>& state,
+                       const path_prefix& prefix,
+                       const std::shared_ptr<element_mark>& mark)
+    {
+        auto address = &element.get();
+        state->keep(on_member_change(element, mark_element{mark, address}));
+        state->keep(path_resolver<Steps...>::connect
+                    (element, state, append(prefix, container, address)));
+    }
+};
+
+}
+
+/// Connection of `on_path_change()`
+class path_connection
+{
+public:
+    path_connection() = default;
+
+    path_connection(boost::signals2::connection conn,
+                    std::shared_ptr<detail::path_state_base> state)
+        : _conn(std::move(conn))
+        , _state(std::move(state))
+    {}
+
+    void disconnect()
+    {
+        if (_state) _state->disconnect();
+        _conn.disconnect();
+    }
+
+    bool connected() const noexcept
+    { return _state && _state->connected; }
+
+private:
+    boost::signals2::connection _conn;
+    std::shared_ptr<detail::path_state_base> _state;
+};
+
+/// Connects `f(const path_t&)` to the changes of what is reached by
+/// the path `Steps` from `o`. A step is the tag of a member of a
+/// class or `any`, which matches any element of a vector.
+///
+/// The path is resolved once, when the connection is made. Changes to
+/// the members of an element are notified while the observable of
+/// the element is alive. A change to a whole element, like the ones
+/// made by `vector::modify()`, is notified to every path through it,
+/// because it may have changed any one of its members.
+///
+/// Example: on_path_change<kids, any, name>(operson, f)
+template<typename... Steps, typename Observable, typename F>
+inline path_connection on_path_change(Observable& o, F&& f)
+{
+    auto state = std::make_shared<
+        detail::path_state<typename std::decay<F>::type>>
+        (std::forward<F>(f));
+    auto conn = detail::path_resolver<Steps...>::connect
+        (o, state, []{ return path_t{}; });
+    return path_connection(std::move(conn), std::move(state));
+}
+
+}
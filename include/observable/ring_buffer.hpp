@@ -0,0 +1,239 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/circular_buffer.hpp>
+#include <boost/signals2.hpp>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace observable {
+
+template<typename Observed_>
+struct ring_buffer;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_ring_buffer<Observed>::value>::type
+>
+{
+    using type = ring_buffer<Observed>;
+};
+
+/// Observable of a `boost::circular_buffer`, a window of fixed
+/// capacity. Pushing to a full buffer overwrites the element at the
+/// other end, which is announced by `on_evict` before it's
+/// overwritten. All the operations at the ends are constant time.
+///
+/// The elements are read through const access and changed by
+/// `modify()`; there are no observables of the elements.
+template<typename Observed_>
+struct ring_buffer
+{
+    using Observed = Observed_;
+
+    using value_type = typename Observed::value_type;
+    using const_reference = typename Observed::const_reference;
+    using const_pointer = typename Observed::const_pointer;
+    using const_iterator = typename Observed::const_iterator;
+    using const_reverse_iterator = typename Observed::const_reverse_iterator;
+    using size_type = typename Observed::size_type;
+    using capacity_type = typename Observed::capacity_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    ring_buffer() = default;
+
+    ring_buffer(Observed& observed)
+        : _observed(&observed)
+    {}
+
+    const_iterator begin() const noexcept
+    { return _observed->begin(); }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->begin(); }
+
+    const_reverse_iterator crbegin() const noexcept
+    { return _observed->rbegin(); }
+
+    const_iterator end() const noexcept
+    { return _observed->end(); }
+
+    const_iterator cend() const noexcept
+    { return _observed->end(); }
+
+    const_reverse_iterator crend() const noexcept
+    { return _observed->rend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    bool full() const noexcept
+    { return _observed->full(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    capacity_type capacity() const noexcept
+    { return _observed->capacity(); }
+
+    /// Changes the capacity. When it's less than the size, the
+    /// elements at the back are evicted.
+    void set_capacity(capacity_type new_capacity)
+    {
+        for (auto n = size(); n > new_capacity; --n)
+            _on_evict(*_observed, (*_observed)[n - 1]);
+        auto before_size = size();
+        _observed->set_capacity(new_capacity);
+        if (size() != before_size) _on_change(*_observed);
+    }
+
+    /// Changes the capacity. When it's less than the size, the
+    /// elements at the front are evicted.
+    void rset_capacity(capacity_type new_capacity)
+    {
+        for (size_type i = 0; i + new_capacity < size(); ++i)
+            _on_evict(*_observed, (*_observed)[i]);
+        auto before_size = size();
+        _observed->rset_capacity(new_capacity);
+        if (size() != before_size) _on_change(*_observed);
+    }
+
+    const_reference at(size_type pos) const
+    { return _observed->at(pos); }
+
+    const_reference operator[](size_type pos) const
+    { return (*_observed)[pos]; }
+
+    const_reference front() const
+    { return _observed->front(); }
+
+    const_reference back() const
+    { return _observed->back(); }
+
+    /// Mutates the element at `pos` in place through `f` and emits
+    /// `on_value_change` and `on_change`.
+    template<typename F>
+    void modify(size_type pos, F&& f)
+    {
+        if (pos >= _observed->size())
+            throw std::out_of_range("ring_buffer::modify");
+        auto it = _observed->begin() + pos;
+        std::forward<F>(f)(*it);
+        _on_value_change(*_observed, it);
+        _on_change(*_observed);
+    }
+
+    void clear() noexcept
+    {
+        _before_erase(*_observed, _observed->end());
+        _observed->clear();
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    void push_back(const value_type& value)
+    { push(value, back_tag{}); }
+
+    void push_back(value_type&& value)
+    { push(std::move(value), back_tag{}); }
+
+    void push_front(const value_type& value)
+    { push(value, front_tag{}); }
+
+    void push_front(value_type&& value)
+    { push(std::move(value), front_tag{}); }
+
+    void pop_back()
+    {
+        _before_erase(*_observed, std::prev(_observed->end()));
+        _observed->pop_back();
+        _on_erase(*_observed, _observed->end());
+        _on_change(*_observed);
+    }
+
+    void pop_front()
+    {
+        _before_erase(*_observed, _observed->begin());
+        _observed->pop_front();
+        _on_erase(*_observed, _observed->begin());
+        _on_change(*_observed);
+    }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, const value_type& evicted)` to the
+    /// eviction of an element because the capacity was exceeded.
+    template<typename F>
+    boost::signals2::connection on_evict(F&& f)
+    { return _on_evict.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _on_value_change, _before_erase;
+
+    detail::lazy_signal<void(const Observed&, const value_type&)> _on_evict;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+private:
+    struct back_tag{};
+    struct front_tag{};
+
+    template<typename T>
+    void push(T&& value, back_tag)
+    {
+        if (_observed->capacity() == 0) return;
+        if (_observed->full()) _on_evict(*_observed, _observed->front());
+        _observed->push_back(std::forward<T>(value));
+        _on_insert(*_observed, std::prev(_observed->end()));
+        _on_change(*_observed);
+    }
+
+    template<typename T>
+    void push(T&& value, front_tag)
+    {
+        if (_observed->capacity() == 0) return;
+        if (_observed->full()) _on_evict(*_observed, _observed->back());
+        _observed->push_front(std::forward<T>(value));
+        _on_insert(*_observed, _observed->begin());
+        _on_change(*_observed);
+    }
+};
+
+}
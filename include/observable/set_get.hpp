@@ -1,4 +1,3 @@
-
 // Copyright Ricardo Calheiros de Miranda Cosme 2017.
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE or copy at
@@ -8,16 +7,60 @@
 
 #include <boost/signals2.hpp>
 
+#include <functional>
+#include <type_traits>
+#include <utility>
+
 namespace observable {
     
-template<typename Observed_>
+template<typename Observed_,
+         typename Setter_ = std::function<void(Observed_)>,
+         typename Getter_ = std::function<const Observed_&()>>
 struct set_get
 {
     using Observed = Observed_;
-    using Setter = std::function<void(Observed)>;
-    using Getter = std::function<const Observed&()>;
+    using Setter = Setter_;
+    using Getter = Getter_;
     Setter setter;
     Getter getter;
 };
 
+/// Setter that calls the member function `Set` of an object of
+/// `Class`.
+///
+/// Example: mem_setter<foo_t, float, &foo_t::val>{&foo}
+template<typename Class, typename Arg, void (Class::*Set)(Arg)>
+struct mem_setter
+{
+    template<typename T>
+    void operator()(T&& o) const
+    { (obj->*Set)(std::forward<T>(o)); }
+    
+    Class* obj;
+};
+    
+/// Getter that calls the const member function `Get` of an object of
+/// `Class`. `Get` must return a const reference to the value, which
+/// `setter_value::get()` returns without a copy.
+///
+/// Example: mem_getter<foo_t, float, &foo_t::val>{&foo}
+template<typename Class, typename Ret, const Ret& (Class::*Get)() const>
+struct mem_getter
+{
+    const Ret& operator()() const
+    { return (obj->*Get)(); }
+    
+    const Class* obj;
+};
+    
+/// Returns a set_get that stores the callables with their own types
+/// instead of std::function, so the calls can be inlined. If `getter`
+/// returns by value, `setter_value::get()` returns a copy too.
+template<typename Observed, typename Setter, typename Getter>
+inline set_get<Observed,
+               typename std::decay<Setter>::type,
+               typename std::decay<Getter>::type>
+make_set_get(Setter&& setter, Getter&& getter)
+{ return {std::forward<Setter>(setter), std::forward<Getter>(getter)}; }
+    
 }
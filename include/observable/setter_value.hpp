@@ -6,15 +6,20 @@
 
 #pragma once
 
+#include "observable/detail/assignable.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
 #include <boost/signals2.hpp>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 namespace observable { 
 
-template<typename Observed_>
+template<typename SetGet, typename Equal_ = never_equal>
 struct setter_value;
     
 template<typename Observed>
@@ -26,12 +31,21 @@ struct observable_of<
     using type = setter_value<Observed>;
 };
     
-template<typename SetGet>
+template<typename SetGet, typename Equal_>
 struct setter_value
 {
     using Observed = typename SetGet::Observed;
+    using Equal = Equal_;
     using Setter = typename SetGet::Setter;
     using Getter = typename SetGet::Getter;
+
+    /// Type returned by `get()`: the reference returned by the getter,
+    /// or a copy of the value if the getter returns by value, which
+    /// would leave a reference to a temporary.
+    using get_result_t = typename std::conditional<
+        std::is_reference<decltype(std::declval<const Getter&>()())>::value,
+        const Observed&,
+        Observed>::type;
     
     setter_value() = default;
 
@@ -48,6 +62,14 @@ struct setter_value
     {
     }
 
+    template<typename E>
+    setter_value(setter_value<SetGet, E>&& rhs) noexcept
+        : _setter(std::move(rhs._setter))
+        , _getter(std::move(rhs._getter))
+        , _on_change(std::move(rhs._on_change))
+    {
+    }
+
     //noexcept to variant assignment?
     setter_value& operator=(setter_value&& rhs) noexcept
     {
@@ -64,13 +86,32 @@ struct setter_value
         return *this;
     }
     
-    void assign(Observed o)
+    void assign(const Observed& o)
+    {
+        if (Equal{}(_getter(), o)) return;
+        _setter(o);
+        _on_change(_getter());
+    }
+    
+    void assign(Observed&& o)
     {
+        if (Equal{}(_getter(), o)) return;
+        _setter(std::move(o));
+        _on_change(_getter());
+    }
+
+    /// Mutates a copy of the observed value through `f`, sets it and
+    /// emits `on_change`. The equality policy isn't used.
+    template<typename F>
+    void modify(F&& f)
+    {
+        Observed o = _getter();
+        std::forward<F>(f)(o);
         _setter(std::move(o));
         _on_change(_getter());
     }
     
-    const Observed& get() const noexcept
+    get_result_t get() const
     { return _getter(); }
     
     template<typename F>
@@ -79,9 +120,21 @@ struct setter_value
         return _on_change.connect(std::forward<F>(f));
     }
     
-    Setter _setter;
-    Getter _getter;
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::assignable_t<Setter> _setter;
+    detail::assignable_t<Getter> _getter;
+    detail::lazy_signal<void(const Observed&)> _on_change;
 };
+
+template<typename SetGet, typename E, typename Equal>
+struct with_equal<setter_value<SetGet, E>, Equal>
+{ using type = setter_value<SetGet, Equal>; };
+
+namespace detail {
+
+template<typename SetGet, typename Equal>
+struct is_assignable_in_place<setter_value<SetGet, Equal>>
+    : std::true_type {};
+
+}
     
 }
@@ -0,0 +1,206 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <boost/signals2.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace observable {
+
+/// Queue of timers driven by the caller. `run()` executes the timers
+/// that are due according to `Clock::now()`. Nothing is executed in
+/// another thread.
+template<typename Clock = std::chrono::steady_clock>
+class timer_queue
+{
+public:
+    using clock = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    void schedule(time_point when, std::function<void()> f)
+    { _timers.emplace(when, std::move(f)); }
+
+    /// Executes the timers that are due and returns how many were
+    /// executed.
+    std::size_t run()
+    {
+        std::size_t n{0};
+        auto now = Clock::now();
+        while (!_timers.empty() && _timers.begin()->first <= now)
+        {
+            auto f = std::move(_timers.begin()->second);
+            _timers.erase(_timers.begin());
+            f();
+            ++n;
+        }
+        return n;
+    }
+
+    bool empty() const noexcept
+    { return _timers.empty(); }
+
+    std::size_t size() const noexcept
+    { return _timers.size(); }
+    
+    /// Time point of the next timer. The queue must not be empty.
+    time_point next() const
+    { return _timers.begin()->first; }
+    
+private:
+    std::multimap<time_point, std::function<void()>> _timers;
+};
+
+namespace detail {
+
+/// State of a rate limited slot. The latest value is copied while a
+/// timer is pending because the reference received by the slot may
+/// not outlive the emission: it can be a temporary returned by a
+/// getter or an element that is erased before the timer fires.
+template<typename Observed, typename Queue, typename F>
+struct rate_limit_state
+{
+    using time_point = typename Queue::time_point;
+    using duration = typename Queue::duration;
+
+    template<typename F_>
+    rate_limit_state(Queue& queue, duration period, F_&& f)
+        : _queue(queue)
+        , _period(period)
+        , _f(std::forward<F_>(f))
+    {}
+
+    /// Calls `f` with the latest value, which is moved out first
+    /// because `f` may change the observable again.
+    void fire()
+    {
+        Observed latest(std::move(*_latest));
+        _latest = boost::none;
+        _f(latest);
+    }
+    
+    Queue& _queue;
+    duration _period;
+    F _f;
+    time_point _last;
+    time_point _deadline;
+    boost::optional<Observed> _latest;
+    bool _fired{false};
+    bool _scheduled{false};
+};
+    
+template<typename Observed, typename Queue, typename F>
+struct throttle_slot
+{
+    using state_t = rate_limit_state<Observed, Queue, F>;
+    
+    void operator()(const Observed& o) const
+    {
+        auto& s = *_state;
+        auto now = Queue::clock::now();
+        if (!s._scheduled && (!s._fired || now - s._last >= s._period))
+        {
+            s._fired = true;
+            s._last = now;
+            s._f(o);
+            return;
+        }
+        s._latest.emplace(o);
+        if (s._scheduled) return;
+        s._scheduled = true;
+        std::weak_ptr<state_t> wstate = _state;
+        s._queue.schedule(s._last + s._period, [wstate]
+        {
+            auto state = wstate.lock();
+            if (!state) return;
+            state->_scheduled = false;
+            state->_last = Queue::clock::now();
+            state->fire();
+        });
+    }
+    
+    std::shared_ptr<state_t> _state;
+};
+    
+template<typename Observed, typename Queue, typename F>
+struct debounce_slot
+{
+    using state_t = rate_limit_state<Observed, Queue, F>;
+    
+    void operator()(const Observed& o) const
+    {
+        auto& s = *_state;
+        s._latest.emplace(o);
+        s._deadline = Queue::clock::now() + s._period;
+        if (!s._scheduled) schedule(_state);
+    }
+
+    static void schedule(const std::shared_ptr<state_t>& state)
+    {
+        state->_scheduled = true;
+        std::weak_ptr<state_t> wstate = state;
+        state->_queue.schedule(state->_deadline, [wstate]
+        {
+            auto state = wstate.lock();
+            if (!state) return;
+            //new changes arrived after the timer was scheduled
+            if (Queue::clock::now() < state->_deadline)
+                return schedule(state);
+            state->_scheduled = false;
+            state->fire();
+        });
+    }
+    
+    std::shared_ptr<state_t> _state;
+};
+    
+}
+
+/// Connects `f` to `o.on_change` executing it at most once per
+/// `period`. The first change is delivered immediately and the
+/// changes that happen inside the period are coalesced into one call
+/// executed by `queue` at the end of the period with a copy of the
+/// latest value.
+template<typename Observable, typename Queue, typename F>
+boost::signals2::connection throttle(Observable& o,
+                                     typename Queue::duration period,
+                                     Queue& queue,
+                                     F&& f)
+{
+    using slot_t = detail::throttle_slot<
+        typename Observable::Observed,
+        Queue,
+        typename std::decay<F>::type>;
+    return o.on_change(slot_t{std::make_shared<typename slot_t::state_t>
+                              (queue, period, std::forward<F>(f))});
+}
+    
+/// Connects `f` to `o.on_change` executing it only after `period`
+/// without changes. The call is executed by `queue` with a copy of
+/// the latest value.
+template<typename Observable, typename Queue, typename F>
+boost::signals2::connection debounce(Observable& o,
+                                     typename Queue::duration period,
+                                     Queue& queue,
+                                     F&& f)
+{
+    using slot_t = detail::debounce_slot<
+        typename Observable::Observed,
+        Queue,
+        typename std::decay<F>::type>;
+    return o.on_change(slot_t{std::make_shared<typename slot_t::state_t>
+                              (queue, period, std::forward<F>(f))});
+}
+    
+}
@@ -6,13 +6,29 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
 #include <map>
+#include <set>
+#include <tuple>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <boost/circular_buffer_fwd.hpp>
+#include <boost/config.hpp>
+#include <boost/container/container_fwd.hpp>
+#include <boost/optional/optional_fwd.hpp>
 #include <boost/variant.hpp>
 #include <observable/set_get.hpp>
 
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+#include <optional>
+#endif
+
+#ifndef BOOST_NO_CXX17_HDR_VARIANT
+#include <variant>
+#endif
+
 namespace observable {
     
 template<typename Observed>
@@ -21,31 +37,81 @@ struct is_class : std::false_type {};
 template<typename Observed>
 struct is_map : std::false_type {};
 
-//?    
-template<typename Key, typename T>
-struct is_map<std::map<Key, T>>
+template<typename Key, typename T, typename Compare, typename Allocator>
+struct is_map<std::map<Key, T, Compare, Allocator>>
+    : std::true_type {};
+    
+template<typename Observed>
+struct is_multimap : std::false_type {};
+
+template<typename Key, typename T, typename Compare, typename Allocator>
+struct is_multimap<std::multimap<Key, T, Compare, Allocator>>
+    : std::true_type {};
+    
+template<typename Observed>
+struct is_flat_map : std::false_type {};
+
+template<typename Key, typename T, typename Compare, typename Allocator>
+struct is_flat_map<boost::container::flat_map<Key, T, Compare, Allocator>>
     : std::true_type {};
     
 template<typename Observed>
 struct is_unordered_map : std::false_type {};
 
-//?    
-template<typename Key, typename T>
-struct is_unordered_map<std::unordered_map<Key, T>>
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Allocator>
+struct is_unordered_map<std::unordered_map<Key, T, Hash, KeyEqual, Allocator>>
     : std::true_type {};
     
+template<typename Observed>
+struct is_unordered_multimap : std::false_type {};
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Allocator>
+struct is_unordered_multimap<
+    std::unordered_multimap<Key, T, Hash, KeyEqual, Allocator>>
+    : std::true_type {};
+    
+template<typename T>
+struct is_set : std::false_type {};
+    
+template<typename T, typename Compare, typename Allocator>
+struct is_set<std::set<T, Compare, Allocator>>
+    : std::true_type {};
+            
+template<typename T>
+struct is_multiset : std::false_type {};
+    
+template<typename T, typename Compare, typename Allocator>
+struct is_multiset<std::multiset<T, Compare, Allocator>>
+    : std::true_type {};
+            
 template<typename T>
 struct is_vector : std::false_type {};
     
+template<typename T, typename Allocator>
+struct is_vector<std::vector<T, Allocator>>
+    : std::true_type {};
+            
 template<typename T>
-struct is_vector<std::vector<T>>
+struct is_deque : std::false_type {};
+    
+template<typename T, typename Allocator>
+struct is_deque<std::deque<T, Allocator>>
     : std::true_type {};
             
 template<typename T>
-struct is_unordered_set : std::false_type {};
+struct is_ring_buffer : std::false_type {};
     
+template<typename T, typename Allocator>
+struct is_ring_buffer<boost::circular_buffer<T, Allocator>>
+    : std::true_type {};
+            
 template<typename T>
-struct is_unordered_set<std::unordered_set<T>>
+struct is_unordered_set : std::false_type {};
+    
+template<typename T, typename Hash, typename KeyEqual, typename Allocator>
+struct is_unordered_set<std::unordered_set<T, Hash, KeyEqual, Allocator>>
     : std::true_type {};
     
 template<typename T>
@@ -55,11 +121,40 @@ template<BOOST_VARIANT_ENUM_PARAMS(typename T)>
 struct is_variant<boost::variant<BOOST_VARIANT_ENUM_PARAMS(T)>>
     : std::true_type {};
 
+#ifndef BOOST_NO_CXX17_HDR_VARIANT
+template<typename... Ts>
+struct is_variant<std::variant<Ts...>>
+    : std::true_type {};
+#endif
+
+template<typename T>
+struct is_array : std::false_type {};
+
+template<typename T, std::size_t N>
+struct is_array<std::array<T, N>> : std::true_type {};
+
+template<typename T>
+struct is_tuple : std::false_type {};
+
+template<typename... Ts>
+struct is_tuple<std::tuple<Ts...>> : std::true_type {};
+
+template<typename T>
+struct is_optional : std::false_type {};
+
+template<typename T>
+struct is_optional<boost::optional<T>> : std::true_type {};
+
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+template<typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+#endif
+
 template<typename T>
 struct is_set_get : std::false_type {};
     
-template<typename T>
-struct is_set_get<set_get<T>> : std::true_type {};
+template<typename T, typename Setter, typename Getter>
+struct is_set_get<set_get<T, Setter, Getter>> : std::true_type {};
     
 }
 
@@ -0,0 +1,170 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/detail/type_list.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace observable {
+
+template<typename Observed_>
+class tuple;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_tuple<Observed>::value>::type
+>
+{
+    using type = tuple<Observed>;
+};
+
+namespace detail {
+
+/// Tuple with the observables of the elements of `Tuple`
+template<typename Tuple>
+struct observable_elements;
+
+template<typename... Ts>
+struct observable_elements<std::tuple<Ts...>>
+{ using type = std::tuple<observable_of_t<Ts>...>; };
+
+}
+
+/// Observable of a `std::tuple` with one observable for each element,
+/// like a `class_` whose members are identified by their positions
+/// instead of tags. A change of an element is notified by the
+/// observable of the element, `on_element_change` and `on_change`.
+template<typename Observed_>
+class tuple
+{
+    using Elements = typename detail::observable_elements<Observed_>::type;
+
+    using indices = typename detail::make_index_list<
+        std::tuple_size<Observed_>::value>::type;
+
+    using on_change_conns_t = std::array<
+        boost::signals2::scoped_connection,
+        std::tuple_size<Observed_>::value>;
+
+public:
+    using Observed = Observed_;
+
+    template<std::size_t I>
+    using observable_t = typename std::tuple_element<I, Elements>::type;
+
+    tuple() = default;
+
+    tuple(Observed& observed)
+        : tuple(observed, indices{})
+    {}
+
+    tuple(tuple&& rhs) noexcept
+        : _observed(rhs._observed)
+        , _elements(std::move(rhs._elements))
+        , _on_change(std::move(rhs._on_change))
+        , _on_element_change(std::move(rhs._on_element_change))
+    {
+        for (auto& c : rhs._on_change_conns) c.disconnect();
+        connect(indices{});
+    }
+
+    tuple& operator=(tuple&& rhs) noexcept
+    {
+        for (auto& c : rhs._on_change_conns) c.disconnect();
+        _observed = rhs._observed;
+        _elements = std::move(rhs._elements);
+        _on_change = std::move(rhs._on_change);
+        _on_element_change = std::move(rhs._on_element_change);
+        connect(indices{});
+        return *this;
+    }
+
+    template<std::size_t I, typename T>
+    void assign(T&& o)
+    { get<I>().assign(std::forward<T>(o)); }
+
+    template<std::size_t I, typename F>
+    void modify(F&& f)
+    { get<I>().modify(std::forward<F>(f)); }
+
+    template<std::size_t I>
+    observable_t<I>& get() noexcept
+    { return std::get<I>(_elements); }
+
+    template<std::size_t I, typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return get<I>().on_change(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, std::size_t)`, which receives the
+    /// position of the element that was changed.
+    template<typename F>
+    boost::signals2::connection on_element_change(F&& f)
+    { return _on_element_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+private:
+    template<std::size_t... Is>
+    tuple(Observed& observed, detail::index_list<Is...>)
+        : _observed(&observed)
+        , _elements(observable_t<Is>
+                    (observable_factory(std::get<Is>(observed)))...)
+    { connect(indices{}); }
+
+    template<std::size_t... Is>
+    void connect(detail::index_list<Is...>)
+    {
+        int expand[] = {0, (_on_change_conns[Is] =
+                            forward(std::get<Is>(_elements), Is), 0)...};
+        (void)expand;
+    }
+
+    template<typename Observable>
+    boost::signals2::connection forward(Observable& o, std::size_t element)
+    {
+        return o.on_change(
+            [this, element](const typename Observable::Observed&)
+            {
+                _on_change(get());
+                _on_element_change(get(), element);
+            });
+    }
+
+    Observed* _observed{nullptr};
+    Elements _elements;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&, std::size_t)> _on_element_change;
+    on_change_conns_t _on_change_conns;
+
+    friend struct detail::access;
+};
+
+namespace detail {
+
+template<typename... Ts>
+struct is_assignable_in_place<tuple<std::tuple<Ts...>>>
+    : all_assignable_in_place<observable_of_t<Ts>...> {};
+
+}
+
+}
@@ -19,6 +19,10 @@ struct observable_of
     
 template<typename T>
 using observable_of_t = typename observable_of<T>::type;
+
+template<typename T, typename Equal>
+struct observable_of<distinct<T, Equal>>
+{ using type = typename with_equal<observable_of_t<T>, Equal>::type; };
         
 }
 
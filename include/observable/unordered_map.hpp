@@ -6,6 +6,10 @@
 
 #pragma once
 
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/merge.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
@@ -29,16 +33,20 @@ struct observable_of<
     using type = unordered_map<Observed>;
 };
     
-template<typename Observed>    
+/// Iterator over the elements of an unordered map, or of one of its
+/// buckets with `Base` being a local iterator, that yields the
+/// observables of the mapped values.
+template<typename Observed,
+         typename Base = typename Observed::Observed::iterator>
 class unordered_map_iterator
     : public boost::iterator_adaptor<
-        unordered_map_iterator<Observed>,
-        typename Observed::Observed::iterator,
+        unordered_map_iterator<Observed, Base>,
+        Base,
         std::pair<
             typename Observed::Observed::key_type,
             std::shared_ptr<typename Observed::reference>
         >,
-        boost::bidirectional_traversal_tag,
+        boost::forward_traversal_tag,
         std::pair<
             typename Observed::Observed::key_type,
             std::shared_ptr<typename Observed::reference>
@@ -50,7 +58,7 @@ public:
     unordered_map_iterator() = default;
 
     explicit unordered_map_iterator
-    (Observed& observed, const typename Observed::Observed::iterator& it)
+    (Observed& observed, const Base& it)
         : unordered_map_iterator::iterator_adaptor_(it)
         , _observed(&observed)
     {}
@@ -63,10 +71,8 @@ private:
     
     value dereference() const
     {
-        auto it = this->base_reference();
-        //TODO:lvalue ref?
-        auto& p = *it;        
-        return std::make_pair(p.first, _observed->get_reference(it));
+        auto& p = *this->base_reference();
+        return std::make_pair(p.first, _observed->get_reference(p));
     }
     Observed* _observed{nullptr};    
 };
@@ -87,7 +93,8 @@ struct unordered_map
     using const_pointer = typename Observed::const_pointer;
     using iterator = unordered_map_iterator<unordered_map<Observed>>;
     using const_iterator = typename Observed::const_iterator;
-    //TODO local_iterator
+    using local_iterator = unordered_map_iterator<
+        unordered_map<Observed>, typename Observed::local_iterator>;
     using const_local_iterator = typename Observed::const_local_iterator;
     using size_type = typename Observed::size_type;
     using difference_type = typename Observed::difference_type;
@@ -97,6 +104,8 @@ struct unordered_map
     
     unordered_map(Observed& observed)
         : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
     {}
     
     iterator begin() noexcept
@@ -120,6 +129,56 @@ struct unordered_map
     size_type max_size() const noexcept
     { return _observed->max_size(); }
 
+    local_iterator begin(size_type n)
+    { return local_iterator(*this, _observed->begin(n)); }
+
+    const_local_iterator cbegin(size_type n) const
+    { return _observed->cbegin(n); }
+
+    local_iterator end(size_type n)
+    { return local_iterator(*this, _observed->end(n)); }
+
+    const_local_iterator cend(size_type n) const
+    { return _observed->cend(n); }
+
+    size_type bucket_count() const noexcept
+    { return _observed->bucket_count(); }
+
+    size_type max_bucket_count() const noexcept
+    { return _observed->max_bucket_count(); }
+
+    size_type bucket_size(size_type n) const
+    { return _observed->bucket_size(n); }
+
+    size_type bucket(const key_type& key) const
+    { return _observed->bucket(key); }
+
+    float load_factor() const noexcept
+    { return _observed->load_factor(); }
+
+    float max_load_factor() const noexcept
+    { return _observed->max_load_factor(); }
+
+    void max_load_factor(float ml)
+    { _observed->max_load_factor(ml); }
+
+    /// Rehashes the observed container without notifying; the
+    /// elements don't change. The observables of the elements stay
+    /// valid because a rehash doesn't move the elements.
+    void rehash(size_type count)
+    { _observed->rehash(count); }
+
+    /// Reserves space for `count` elements, avoiding the rehashes of
+    /// a bulk insertion.
+    void reserve(size_type count)
+    { _observed->reserve(count); }
+
+    hasher hash_function() const
+    { return _observed->hash_function(); }
+
+    key_equal key_eq() const
+    { return _observed->key_eq(); }
+
     void clear() noexcept
     {
         _before_erase(*_observed, _observed->cend());
@@ -252,13 +311,69 @@ struct unordered_map
         _on_erase(*_observed, value_type{}, const_iterator{});
         _on_change(*_observed);
     }
-    
+
+    /// Merges `source` into the observed map using one lookup by
+    /// element. The signals `before_erase`, `on_erase`, `on_insert`
+    /// and `on_value_change` are emitted for each element, an updated
+    /// value is also notified by its observable if it's alive, and
+    /// `on_change` is emitted only once at the end, followed by
+    /// `on_merge` with the change set. Two mapped values that are equal
+    /// according to `equal` aren't updated.
+    template<typename Source, typename Equal = never_equal>
+    merge_result merge(Source&& source,
+                       merge_policy policy = merge_policy::upsert,
+                       Equal equal = Equal{})
+    {
+        static_assert(std::is_same<typename std::decay<Source>::type,
+                                   Observed>::value,
+                      "source must be of the observed type");
+        merge_result ret;
+        detail::merging_guard guard(_merging);
+        if (policy == merge_policy::replace)
+            for (auto it = _observed->begin(); it != _observed->end();)
+            {
+                if (source.count(it->first) > 0)
+                {
+                    ++it;
+                    continue;
+                }
+                auto e = *it;
+                _before_erase(*_observed, it);
+                it = _observed->erase(it);
+                _on_erase(*_observed, std::move(e), it);
+                ++ret.erased;
+            }
+        for (auto&& e : source)
+        {
+            auto it = _observed->find(e.first);
+            if (it == _observed->end())
+            {
+                it = _observed->emplace
+                    (detail::forward_element<Source>(e)).first;
+                _on_insert(*_observed, it);
+                ++ret.inserted;
+            }
+            else if (!equal(it->second, e.second))
+            {
+                it->second = detail::forward_element<Source>(e.second);
+                notify_value_change(it);
+                ++ret.updated;
+            }
+        }
+        if (ret.changed())
+        {
+            _on_change(*_observed);
+            _on_merge(*_observed, ret);
+        }
+        return ret;
+    }
+
     std::shared_ptr<reference> at(const key_type& key)
     {
         auto it = _observed->find(key);
         if (it == _observed->end())
             throw std::out_of_range("unordered_map::at");
-        return get_reference(it);
+        return get_reference(*it);
     }
     
     const mapped_type&
@@ -271,7 +386,7 @@ struct unordered_map
         if (it == _observed->end())
             it = _observed->insert(it, value_type
                                (key, mapped_type()));
-        return get_reference(it);
+        return get_reference(*it);
     }
     
     std::shared_ptr<reference> operator[](key_type&& key)
@@ -280,7 +395,21 @@ struct unordered_map
         if (it == _observed->end())
             it = _observed->insert(it, value_type
                                (std::move(key), mapped_type()));
-        return get_reference(it);
+        return get_reference(*it);
+    }
+    
+    /// Mutates the value mapped to `key` in place through `f` and
+    /// emits `on_value_change` and `on_change`. An observable of the
+    /// element is only notified if it's alive; no observable is
+    /// created.
+    template<typename F>
+    void modify(const key_type& key, F&& f)
+    {
+        auto it = _observed->find(key);
+        if (it == _observed->end())
+            throw std::out_of_range("unordered_map::modify");
+        std::forward<F>(f)(it->second);
+        notify_value_change(it);
     }
     
     size_type count
@@ -326,49 +455,86 @@ struct unordered_map
     template<typename F>
     boost::signals2::connection on_value_change(F&& f)
     { return _on_value_change.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, const merge_result&)` to the
+    /// merges that change the map. It's emitted once by `merge()`,
+    /// after `on_change`.
+    template<typename F>
+    boost::signals2::connection on_merge(F&& f)
+    { return _on_merge.connect(std::forward<F>(f)); }
     
     const Observed& get() const noexcept
     { return *_observed; }
     
     Observed* _observed;
     
-    boost::signals2::signal<void(const Observed&, const_iterator)>
+    detail::lazy_signal<void(const Observed&, const_iterator)>
     _on_insert, _on_value_change, _before_erase;
     
-    boost::signals2::signal<void(const Observed&, value_type, const_iterator)>
+    detail::lazy_signal<void(const Observed&, value_type, const_iterator)>
     _on_erase;
     
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+    detail::lazy_signal<void(const Observed&, const merge_result&)>
+    _on_merge;
     
-    std::unordered_map<const_pointer,
-                       std::weak_ptr<reference>> _it2observable;
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
 private:
-    std::shared_ptr<reference> get_reference(typename Observed::iterator it)
+    /// Raised by `merge`, which emits `on_change` only once at the end
+    bool _merging{false};
+
+    void notify_value_change(typename Observed::iterator it)
+    {
+        auto oit = _it2observable.find(&*it);
+        if (oit != _it2observable.end())
+            if (auto observable = oit->second.lock())
+            {
+                //the observable of the element notifies the container
+                detail::access::on_change(*observable)(it->second);
+                return;
+            }
+        _on_value_change(*_observed, it);
+        if (!_merging) _on_change(*_observed);
+    }
+    
+    /// Iterator to the element at `p`. A rehash invalidates the
+    /// iterators but not the addresses of the elements, so the
+    /// observables of the elements keep the address and look up the
+    /// iterator when they notify the container.
+    const_iterator iterator_to(const_pointer p) const
+    {
+        auto rng = _observed->equal_range(p->first);
+        while (rng.first != rng.second && &*rng.first != p) ++rng.first;
+        return rng.first;
+    }
+    
+    std::shared_ptr<reference> get_reference(value_type& e)
     {
-        auto observable = _it2observable[&*it].lock();
+        auto observable = _it2observable[&e].lock();
         if (!observable)
         {
             auto& it2observable = _it2observable;
-            auto it_ptr = &*it;
-            observable = std::shared_ptr<reference>
-                (new reference(observable_factory(it->second)),
-                 [&it2observable, it_ptr](reference *p)
-                 {
-                     it2observable.erase(it_ptr);
-                     delete p;
-                 });
+            const_pointer e_ptr = &e;
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(e.second)),
+                 [&it2observable, e_ptr]{ it2observable.erase(e_ptr); });
             auto& container = *this;
-            observable->_on_change.connect(
-                [&container, it](const typename reference::Observed&)
+            detail::access::on_change(*observable).connect(
+                [&container, e_ptr](const typename reference::Observed&)
                 {
-                    container._on_value_change(container.get(), it);
-                    container._on_change(container.get());
+                    container._on_value_change
+                        (container.get(), container.iterator_to(e_ptr));
+                    if (!container._merging)
+                        container._on_change(container.get());
                 });
-            it2observable[&*it] = observable;
+            it2observable[e_ptr] = observable;
         }
         return observable;
     }
-    friend class unordered_map_iterator<unordered_map<Observed>>;
+    template<typename, typename> friend class unordered_map_iterator;
 };
     
 }
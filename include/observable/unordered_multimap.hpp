@@ -0,0 +1,317 @@
+// Copyright Ricardo Calheiros de Miranda Cosme 2017.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/unordered_map.hpp"
+#include "observable/traits.hpp"
+#include "observable/types.hpp"
+
+#include <boost/signals2.hpp>
+#include <memory>
+
+namespace observable {
+
+template<typename Observed_>
+struct unordered_multimap;
+
+template<typename Observed>
+struct observable_of<
+    Observed,
+    typename std::enable_if<is_unordered_multimap<Observed>::value>::type
+>
+{
+    using type = unordered_multimap<Observed>;
+};
+
+/// Observable of a `std::unordered_multimap`. It has the signals of
+/// `map` and the iteration yields observables of the mapped values,
+/// but every insertion inserts and there is no access by key.
+template<typename Observed_>
+struct unordered_multimap
+{
+    using Observed = Observed_;
+
+    using key_type = typename Observed::key_type;
+    using mapped_type = typename Observed::mapped_type;
+    using value_type = typename Observed::value_type;
+    using key_equal = typename Observed::key_equal;
+    using hasher = typename Observed::hasher;
+    using reference = observable_of_t<typename Observed::mapped_type>;
+    using const_reference = typename Observed::const_reference;
+    using pointer = reference*;
+    using const_pointer = typename Observed::const_pointer;
+    using iterator = unordered_map_iterator<unordered_multimap<Observed>>;
+    using const_iterator = typename Observed::const_iterator;
+    using local_iterator = unordered_map_iterator<
+        unordered_multimap<Observed>, typename Observed::local_iterator>;
+    using const_local_iterator = typename Observed::const_local_iterator;
+    using size_type = typename Observed::size_type;
+    using difference_type = typename Observed::difference_type;
+    using allocator_type = typename Observed::allocator_type;
+
+    unordered_multimap() = default;
+
+    unordered_multimap(Observed& observed)
+        : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
+    {}
+
+    iterator begin() noexcept
+    { return iterator(*this, _observed->begin()); }
+
+    const_iterator cbegin() const noexcept
+    { return _observed->cbegin(); }
+
+    iterator end() noexcept
+    { return iterator(*this, _observed->end()); }
+
+    const_iterator cend() const noexcept
+    { return _observed->cend(); }
+
+    bool empty() const noexcept
+    { return _observed->empty(); }
+
+    size_type size() const noexcept
+    { return _observed->size(); }
+
+    size_type max_size() const noexcept
+    { return _observed->max_size(); }
+
+    local_iterator begin(size_type n)
+    { return local_iterator(*this, _observed->begin(n)); }
+
+    const_local_iterator cbegin(size_type n) const
+    { return _observed->cbegin(n); }
+
+    local_iterator end(size_type n)
+    { return local_iterator(*this, _observed->end(n)); }
+
+    const_local_iterator cend(size_type n) const
+    { return _observed->cend(n); }
+
+    size_type bucket_count() const noexcept
+    { return _observed->bucket_count(); }
+
+    size_type max_bucket_count() const noexcept
+    { return _observed->max_bucket_count(); }
+
+    size_type bucket_size(size_type n) const
+    { return _observed->bucket_size(n); }
+
+    size_type bucket(const key_type& key) const
+    { return _observed->bucket(key); }
+
+    float load_factor() const noexcept
+    { return _observed->load_factor(); }
+
+    float max_load_factor() const noexcept
+    { return _observed->max_load_factor(); }
+
+    void max_load_factor(float ml)
+    { _observed->max_load_factor(ml); }
+
+    /// Rehashes the observed container without notifying; the
+    /// elements don't change. The observables of the elements stay
+    /// valid because a rehash doesn't move the elements.
+    void rehash(size_type count)
+    { _observed->rehash(count); }
+
+    /// Reserves space for `count` elements, avoiding the rehashes of
+    /// a bulk insertion.
+    void reserve(size_type count)
+    { _observed->reserve(count); }
+
+    hasher hash_function() const
+    { return _observed->hash_function(); }
+
+    key_equal key_eq() const
+    { return _observed->key_eq(); }
+
+    void clear() noexcept
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->clear();
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        _before_erase(*_observed, pos);
+        auto it = _observed->erase(pos);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    iterator erase(const_iterator first,
+                   const_iterator last)
+    {
+        _before_erase(*_observed, first);
+        auto it = _observed->erase(first, last);
+        _on_erase(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    size_type erase(const key_type& key)
+    {
+        auto rng = _observed->equal_range(key);
+        if (rng.first == rng.second) return 0;
+        auto before_size = _observed->size();
+        erase(rng.first, rng.second);
+        return before_size - _observed->size();
+    }
+
+    template<typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        auto it = _observed->emplace(std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    template<typename... Args>
+    iterator emplace_hint
+    (const_iterator hint, Args&&... args)
+    {
+        auto it = _observed->emplace_hint(hint, std::forward<Args>(args)...);
+        _on_insert(*_observed, it);
+        _on_change(*_observed);
+        return iterator(*this, it);
+    }
+
+    iterator insert(const value_type& value)
+    { return emplace(value); }
+
+    iterator insert(value_type&& value)
+    { return emplace(std::move(value)); }
+
+    iterator insert(const_iterator hint,
+                    const value_type& value)
+    { return emplace_hint(hint, value); }
+
+    template<typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if (first == last) return;
+        _observed->insert(first, last);
+        _on_insert(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    { insert(ilist.begin(), ilist.end()); }
+
+    void swap(Observed& other)
+    {
+        _before_erase(*_observed, _observed->cend());
+        _observed->swap(other);
+        _on_insert(*_observed, const_iterator{});
+        _on_erase(*_observed, const_iterator{});
+        _on_change(*_observed);
+    }
+
+    size_type count
+    (const key_type& key) const
+    { return _observed->count(key); }
+
+    iterator find(const key_type& key)
+    { return iterator(*this, _observed->find(key)); }
+
+    const_iterator find
+    (const key_type& key) const
+    { return _observed->find(key); }
+
+    std::pair<iterator, iterator> equal_range
+    (const key_type& key)
+    {
+        auto p = _observed->equal_range(key);
+        return std::make_pair(iterator(*this, p.first),
+                              iterator(*this, p.second));
+    }
+
+    std::pair<const_iterator,
+              const_iterator> equal_range
+    (const key_type& key) const
+    { return _observed->equal_range(key); }
+
+    template<typename F>
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_erase(F&& f)
+    { return _on_erase.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_insert(F&& f)
+    { return _on_insert.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_change(F&& f)
+    { return _on_change.connect(std::forward<F>(f)); }
+
+    template<typename F>
+    boost::signals2::connection on_value_change(F&& f)
+    { return _on_value_change.connect(std::forward<F>(f)); }
+
+    const Observed& get() const noexcept
+    { return *_observed; }
+
+    Observed* _observed;
+
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_erase, _on_insert, _on_value_change, _before_erase;
+
+    detail::lazy_signal<void(const Observed&)> _on_change;
+
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
+private:
+    /// Iterator to the element at `p`. A rehash invalidates the
+    /// iterators but not the addresses of the elements, so the
+    /// observables of the elements keep the address and look up the
+    /// iterator when they notify the container.
+    const_iterator iterator_to(const_pointer p) const
+    {
+        auto rng = _observed->equal_range(p->first);
+        while (rng.first != rng.second && &*rng.first != p) ++rng.first;
+        return rng.first;
+    }
+
+    std::shared_ptr<reference> get_reference(value_type& e)
+    {
+        auto observable = _it2observable[&e].lock();
+        if (!observable)
+        {
+            auto& it2observable = _it2observable;
+            const_pointer e_ptr = &e;
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(e.second)),
+                 [&it2observable, e_ptr]{ it2observable.erase(e_ptr); });
+            auto& container = *this;
+            detail::access::on_change(*observable).connect(
+                [&container, e_ptr](const typename reference::Observed&)
+                {
+                    container._on_value_change
+                        (container.get(), container.iterator_to(e_ptr));
+                    container._on_change(container.get());
+                });
+            it2observable[e_ptr] = observable;
+        }
+        return observable;
+    }
+    template<typename, typename> friend class unordered_map_iterator;
+};
+
+}
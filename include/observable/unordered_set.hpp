@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include "observable/detail/lazy_signal.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
 #include <boost/signals2.hpp>
 
+#include <utility>
+
 namespace observable { 
 
 template<typename Observed_>
@@ -40,6 +43,8 @@ struct unordered_set
     using const_pointer = typename Observed::const_pointer;
     using iterator = typename Observed::iterator;
     using const_iterator = typename Observed::const_iterator;
+    using local_iterator = typename Observed::local_iterator;
+    using const_local_iterator = typename Observed::const_local_iterator;
     using size_type = typename Observed::size_type;
     using difference_type = typename Observed::difference_type;
     using allocator_type = typename Observed::allocator_type;
@@ -70,19 +75,79 @@ struct unordered_set
     
     size_type max_size() const noexcept
     { return _observed->max_size(); }
+
+    local_iterator begin(size_type n)
+    { return _observed->begin(n); }
+
+    const_local_iterator cbegin(size_type n) const
+    { return _observed->cbegin(n); }
+
+    local_iterator end(size_type n)
+    { return _observed->end(n); }
+
+    const_local_iterator cend(size_type n) const
+    { return _observed->cend(n); }
+
+    size_type bucket_count() const noexcept
+    { return _observed->bucket_count(); }
+
+    size_type max_bucket_count() const noexcept
+    { return _observed->max_bucket_count(); }
+
+    size_type bucket_size(size_type n) const
+    { return _observed->bucket_size(n); }
+
+    size_type bucket(const key_type& key) const
+    { return _observed->bucket(key); }
+
+    float load_factor() const noexcept
+    { return _observed->load_factor(); }
+
+    float max_load_factor() const noexcept
+    { return _observed->max_load_factor(); }
+
+    void max_load_factor(float ml)
+    { _observed->max_load_factor(ml); }
+
+    /// Rehashes the observed container without notifying; the
+    /// elements don't change.
+    void rehash(size_type count)
+    { _observed->rehash(count); }
+
+    /// Reserves space for `count` elements, avoiding the rehashes of
+    /// a bulk insertion.
+    void reserve(size_type count)
+    { _observed->reserve(count); }
+
+    hasher hash_function() const
+    { return _observed->hash_function(); }
+
+    key_equal key_eq() const
+    { return _observed->key_eq(); }
         
-    void clear() noexcept
+    void clear()
     {
+        notify_before_erase(_observed->cbegin(), _observed->cend());
         _observed->clear();
-        _on_erase(*_observed, value_type{}, const_iterator{});
+        _on_erase(*_observed, _observed->cend());
+        _on_erase_value(*_observed, value_type{}, const_iterator{});
         _on_change(*_observed);
     }
     
     iterator erase(const_iterator pos)        
     {
+        _before_erase(*_observed, *pos);
+        if (_on_erase_value.empty())
+        {
+            auto it = _observed->erase(pos);
+            _on_erase(*_observed, it);
+            _on_change(*_observed);
+            return it;
+        }
         auto e = *pos;
         auto it = _observed->erase(pos);
-        _on_erase(*_observed, std::move(e), it);
+        _on_erase(*_observed, it);
+        _on_erase_value(*_observed, std::move(e), it);
         _on_change(*_observed);
         return it;
     }
@@ -90,22 +155,20 @@ struct unordered_set
     iterator erase(const_iterator first,
                    const_iterator last)        
     {
+        notify_before_erase(first, last);
         auto it = _observed->erase(first, last);
-        _on_erase(*_observed, value_type{}, it);
+        _on_erase(*_observed, it);
+        _on_erase_value(*_observed, value_type{}, it);
         _on_change(*_observed);
         return it;
     }
     
     size_type erase(const key_type& key)
     {
-        auto n = _observed->erase(key);
-        if (n > 0)
-        {
-            //TODO:on_erase
-            _on_erase(*_observed, value_type{}, const_iterator{});
-            _on_change(*_observed);
-        }
-        return n;
+        auto it = _observed->find(key);
+        if (it == _observed->end()) return 0;
+        erase(it);
+        return 1;
     }
     
     template<typename... Args>
@@ -205,10 +268,12 @@ struct unordered_set
     
     void swap(Observed& other)
     {
+        notify_before_erase(_observed->cbegin(), _observed->cend());
         _observed->swap(other);
         //TODO: check?
         _on_insert(*_observed, const_iterator{});
-        _on_erase(*_observed, value_type{}, const_iterator{});
+        _on_erase(*_observed, _observed->cend());
+        _on_erase_value(*_observed, value_type{}, const_iterator{});
         _on_change(*_observed);
     }
 
@@ -234,9 +299,38 @@ struct unordered_set
     (const key_type& key) const
     { return _observed->equal_range(key); }
     
+    /// Connects `f(const Observed&, const value_type&)`, which is
+    /// called with each element that is about to be erased, including
+    /// the ones erased by a range, `clear()` and `swap()`.
     template<typename F>
-    boost::signals2::connection on_erase(F&& f)
+    boost::signals2::connection before_erase(F&& f)
+    { return _before_erase.connect(std::forward<F>(f)); }
+    
+    /// Connects `f(const Observed&, const_iterator)`, which is called
+    /// once after each erasure with the iterator following the erased
+    /// elements.
+    template<typename F>
+    auto on_erase(F&& f)
+    -> decltype(f(std::declval<const Observed&>(),
+                  std::declval<const_iterator>()),
+                boost::signals2::connection())
     { return _on_erase.connect(std::forward<F>(f)); }
+
+    /// Connects `f(const Observed&, value_type, const_iterator)`, which
+    /// receives a copy of the element erased by `erase(pos)` or
+    /// `erase(key)` and a default constructed `value_type` for the
+    /// other erasures.
+    ///
+    /// Deprecated: while such a slot is connected, each erasure of an
+    /// element copies it. Use `before_erase()` to receive the erased
+    /// elements and `on_erase(f(const Observed&, const_iterator))`.
+    template<typename F>
+    auto on_erase(F&& f)
+    -> decltype(f(std::declval<const Observed&>(),
+                  std::declval<value_type>(),
+                  std::declval<const_iterator>()),
+                boost::signals2::connection())
+    { return _on_erase_value.connect(std::forward<F>(f)); }
     
     template<typename F>
     boost::signals2::connection on_insert(F&& f)
@@ -251,13 +345,22 @@ struct unordered_set
     
     Observed* _observed;
     
-    boost::signals2::signal<void(const Observed&, const_iterator)>
-    _on_insert, _on_value_change;
+    detail::lazy_signal<void(const Observed&, const_iterator)>
+    _on_insert, _on_value_change, _on_erase;
     
-    boost::signals2::signal<void(const Observed&, value_type, const_iterator)>
-    _on_erase;
+    detail::lazy_signal<void(const Observed&, const value_type&)>
+    _before_erase;
+
+    detail::lazy_signal<void(const Observed&, value_type, const_iterator)>
+    _on_erase_value;
     
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+private:
+    void notify_before_erase(const_iterator first, const_iterator last)
+    {
+        if (_before_erase.empty()) return;
+        for (; first != last; ++first) _before_erase(*_observed, *first);
+    }
 };
     
 }
@@ -6,14 +6,19 @@
 
 #pragma once
 
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
+#include "observable/equal.hpp"
+
 #include <boost/signals2.hpp>
 
 namespace observable { 
             
-template<typename Observed_>
+template<typename Observed_, typename Equal_ = never_equal>
 struct value
 {
     using Observed = Observed_;
+    using Equal = Equal_;
 
     value() = default;
     
@@ -29,6 +34,13 @@ struct value
     {
     }
 
+    template<typename E>
+    value(value<Observed, E>&& rhs) noexcept
+        : _observed(rhs._observed)
+        , _on_change(std::move(rhs._on_change))
+    {
+    }
+
     //noexcept to variant assignment?
     value& operator=(value&& rhs) noexcept
     {
@@ -44,11 +56,28 @@ struct value
         return *this;
     }
     
-    void assign(Observed o)
+    void assign(const Observed& o)
+    {
+        if (Equal{}(*_observed, o)) return;
+        *_observed = o;
+        _on_change(*_observed);
+    }
+    
+    void assign(Observed&& o)
     {
+        if (Equal{}(*_observed, o)) return;
         *_observed = std::move(o);
         _on_change(*_observed);
     }
+
+    /// Mutates the observed value in place through `f` and emits
+    /// `on_change`. The equality policy isn't used.
+    template<typename F>
+    void modify(F&& f)
+    {
+        std::forward<F>(f)(*_observed);
+        _on_change(*_observed);
+    }
     
     const Observed& get() const noexcept
     { return *_observed; }
@@ -60,7 +89,18 @@ struct value
     }
     
     Observed* _observed{nullptr};
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
 };
+
+template<typename Observed, typename E, typename Equal>
+struct with_equal<value<Observed, E>, Equal>
+{ using type = value<Observed, Equal>; };
+
+namespace detail {
+
+template<typename Observed, typename Equal>
+struct is_assignable_in_place<value<Observed, Equal>> : std::true_type {};
+
+}
     
 }
@@ -8,16 +8,23 @@
 
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
+#include "observable/detail/access.hpp"
+#include "observable/detail/in_place.hpp"
+#include "observable/detail/lazy_signal.hpp"
 #include "observable/detail/match_visitor.hpp"
+#include "observable/detail/type_list.hpp"
+#include "observable/detail/variant_backend.hpp"
 
 #include <boost/signals2.hpp>
 #include <boost/variant.hpp>
 
+#include <cstddef>
+#include <tuple>
 #include <type_traits>
 
 namespace observable { 
 
-template<typename Observed_>
+template<typename Observed_, typename Equal_ = never_equal>
 struct variant;
     
 template<typename Observed>
@@ -47,24 +54,59 @@ struct set_variant_t
     }
     ObservableVariant& _ovariant;
 };
+
+namespace detail {
+
+template<typename Alternatives>
+struct alternative_signals;
+
+/// One signal for each alternative of a variant
+template<typename... Ts>
+struct alternative_signals<type_list<Ts...>>
+{ using type = std::tuple<lazy_signal<void(const Ts&)>...>; };
+    
+}
     
-template<typename Observed_>
-struct variant
+/// Observable of a `boost::variant` or a `std::variant`, which keeps
+/// an observable of the current alternative.
+///
+/// An assignment that changes the type of the alternative creates a
+/// new observable of it and emits `on_change_type` and
+/// `on_change_to`. An assignment of a value of the same type emits
+/// only `on_change` of the observable of the alternative: when the
+/// alternative is a `class_`, the slots connected to its members
+/// aren't executed. The observable is kept if it's still valid for
+/// the value assigned in place, like a `value` or a `class_` of
+/// values. Otherwise, when it has nested observables like the ones of
+/// a `variant` or a container, it's rebuilt and only the slots of its
+/// `on_change` are moved to the new one. Both kinds of assignment emit
+/// `on_alternative` and `on_change`.
+template<typename Observed_, typename Equal_>
+struct variant : detail::variant_typedefs<Observed_>
 {
     using Observed = Observed_;
-    using types = typename Observed::types;
-    using observable_variant_t = typename boost::make_variant_over<
-        typename boost::mpl::transform<
-          types,
-          observable_of<boost::mpl::_1>
-        >::type
-    >::type;
+    using Equal = Equal_;
+    using backend = detail::variant_backend<Observed>;
+    using observable_variant_t = typename backend::observable_variant_t;
+    using alternatives = typename backend::alternatives;
+    using alternative_signals_t =
+        typename detail::alternative_signals<alternatives>::type;
 
     variant() = default;
     
     variant(Observed& observed)
         : _observed(&observed)
-    { assign(*_observed); }
+    { set_ovariant(); }
+
+    template<typename E>
+    variant(variant<Observed, E>&& rhs)
+        : _observed(rhs._observed)
+        , _ovariant(std::move(rhs._ovariant))
+        , _on_change(std::move(rhs._on_change))
+        , _on_change_type(std::move(rhs._on_change_type))
+        , _on_change_to(std::move(rhs._on_change_to))
+        , _on_alternative(std::move(rhs._on_alternative))
+    {}
 
     template<typename T>
     variant& operator=(T&& o)
@@ -73,17 +115,20 @@ struct variant
         return *this;
     }
     
-    void assign(Observed o)
+    void assign(const Observed& o)
+    {
+        if (Equal{}(*_observed, o)) return;
+        auto before_type = backend::index(_ovariant);
+        *_observed = o;
+        on_assign(before_type);
+    }
+    
+    void assign(Observed&& o)
     {
-        auto before_type = _ovariant.which();
+        if (Equal{}(*_observed, o)) return;
+        auto before_type = backend::index(_ovariant);
         *_observed = std::move(o);
-        
-        set_variant_t<observable_variant_t> set_variant(_ovariant);
-        
-        boost::apply_visitor(set_variant, *_observed);
-
-        if(before_type != _ovariant.which()) _on_change_type(*_observed);
-        _on_change(*_observed);
+        on_assign(before_type);
     }
     
     const Observed& get() const noexcept
@@ -91,7 +136,7 @@ struct variant
     
     template<typename Visitor>
     void apply_visitor(Visitor&& visitor)
-    { boost::apply_visitor(std::forward<Visitor>(visitor), _ovariant); }
+    { backend::visit(std::forward<Visitor>(visitor), _ovariant); }
 
     template<typename... Fs>
     inline void match(Fs&&... fs)
@@ -109,11 +154,109 @@ struct variant
     boost::signals2::connection on_change_type(F&& f)
     { return _on_change_type.connect(std::forward<F>(f)); }
     
+    /// Connects `f` to the changes of the alternative type to `T`. The
+    /// slot receives the new value as `const T&`.
+    template<typename T, typename F>
+    boost::signals2::connection on_change_to(F&& f)
+    {
+        return std::get<detail::index_of<T, alternatives>::value>
+            (_on_change_to).connect(std::forward<F>(f));
+    }
+    
+    /// Connects `f` to the changes of the variant while the
+    /// alternative is of type `T`. The slot receives the new value as
+    /// `const T&` and isn't executed for the other alternatives.
+    template<typename T, typename F>
+    boost::signals2::connection on_alternative(F&& f)
+    {
+        return std::get<detail::index_of<T, alternatives>::value>
+            (_on_alternative).connect(std::forward<F>(f));
+    }
+    
     Observed* _observed{nullptr};
     
     observable_variant_t _ovariant;
     
-    boost::signals2::signal<void(const Observed&)> _on_change, _on_change_type;
+    detail::lazy_signal<void(const Observed&)> _on_change, _on_change_type;
+    
+    alternative_signals_t _on_change_to, _on_alternative;
+private:
+    struct notify_alternative
+    {
+        using result_type = void;
+        
+        template<typename Observable>
+        result_type operator()(Observable& o) const
+        {
+            using T = typename Observable::Observed;
+            constexpr auto idx = detail::index_of<T, alternatives>::value;
+            //The alternative was assigned in place and its observable
+            //is bound to it. Only the signal of the observable itself
+            //is emitted, not the ones of its members.
+            if (!_type_changed) detail::access::on_change(o)(o.get());
+            else std::get<idx>(_variant._on_change_to)(o.get());
+            std::get<idx>(_variant._on_alternative)(o.get());
+        }
+        
+        variant& _variant;
+        bool _type_changed;
+    };
+
+    /// Rebuilds the observable of an alternative assigned in place
+    /// when it keeps nested observables, which would still observe
+    /// the previous value, like the alternative of a nested variant.
+    struct refresh_alternative
+    {
+        using result_type = void;
+
+        template<typename Observable>
+        result_type operator()(Observable& o) const
+        {
+            refresh(o, std::integral_constant<
+                    bool, detail::is_assignable_in_place<Observable>::value>{});
+        }
+
+        template<typename Observable>
+        void refresh(Observable&, std::true_type) const
+        {}
+
+        template<typename Observable>
+        void refresh(Observable& o, std::false_type) const
+        {
+            using T = typename Observable::Observed;
+            Observable fresh
+                (observable_factory(backend::template get<T>(*_observed)));
+            detail::access::on_change(fresh) =
+                std::move(detail::access::on_change(o));
+            o = std::move(fresh);
+        }
+
+        Observed* _observed;
+    };
+    
+    void set_ovariant()
+    {
+        set_variant_t<observable_variant_t> set_variant(_ovariant);
+        backend::visit(set_variant, *_observed);
+    }
+
+    void on_assign(std::size_t before_type)
+    {
+        bool type_changed = before_type != backend::index(*_observed);
+        if (type_changed)
+        {
+            set_ovariant();
+            _on_change_type(*_observed);
+        }
+        else backend::visit(refresh_alternative{_observed}, _ovariant);
+        notify_alternative visitor{*this, type_changed};
+        backend::visit(visitor, _ovariant);
+        _on_change(*_observed);
+    }
 };
+
+template<typename Observed, typename E, typename Equal>
+struct with_equal<variant<Observed, E>, Equal>
+{ using type = variant<Observed, Equal>; };
     
 }
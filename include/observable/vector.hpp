@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include "observable/detail/access.hpp"
+#include "observable/detail/element.hpp"
+#include "observable/detail/lazy_signal.hpp"
 #include "observable/traits.hpp"
 #include "observable/types.hpp"
 
@@ -79,6 +82,8 @@ struct vector
     
     vector(Observed& observed)
         : _observed(&observed)
+        , _it2observable(detail::make_element_index<
+                         decltype(_it2observable)>(observed.get_allocator()))
     {}
     
     iterator begin() noexcept
@@ -149,6 +154,19 @@ struct vector
     (size_type pos) const
     { return (*_observed)[pos]; }
 
+    /// Mutates the element at `pos` in place through `f` and emits
+    /// `on_value_change` and `on_change`. An observable of the element
+    /// is only notified if it's alive; no observable is created.
+    template<typename F>
+    void modify(size_type pos, F&& f)
+    {
+        if (pos >= _observed->size())
+            throw std::out_of_range("vector::modify");
+        auto it = _observed->begin() + pos;
+        std::forward<F>(f)(*it);
+        notify_value_change(it);
+    }
+    
     std::shared_ptr<reference> front()
     {
         auto it = _observed->begin();
@@ -283,7 +301,7 @@ struct vector
     
     void pop_back()
     {
-        _before_erase(*_observed, _observed->rbegin().base());
+        _before_erase(*_observed, std::prev(_observed->end()));
         _observed->pop_back();
         _on_erase(*_observed, const_iterator{});
         _on_change(*_observed);
@@ -321,19 +339,41 @@ struct vector
     boost::signals2::connection on_value_change(F&& f)
     { return _on_value_change.connect(std::forward<F>(f)); }
     
+    /// Connects `f(reference&)` to the creation of the observable of
+    /// an element.
+    template<typename F>
+    boost::signals2::connection on_reference(F&& f)
+    { return _on_reference.connect(std::forward<F>(f)); }
+    
     const Observed& get() const noexcept
     { return *_observed; }
     
     Observed* _observed;
     
-    boost::signals2::signal<void(const Observed&, const_iterator)>
+    detail::lazy_signal<void(const Observed&, const_iterator)>
     _on_erase, _on_insert, _on_value_change, _before_erase;
     
-    boost::signals2::signal<void(const Observed&)> _on_change;
+    detail::lazy_signal<void(const Observed&)> _on_change;
+    
+    detail::lazy_signal<void(reference&)> _on_reference;
     
-    std::unordered_map<const_pointer,
-                       std::weak_ptr<reference>> _it2observable;
+    detail::element_index_t<const_pointer, reference, allocator_type>
+    _it2observable;
 private:
+    void notify_value_change(typename Observed::iterator it)
+    {
+        auto oit = _it2observable.find(&*it);
+        if (oit != _it2observable.end())
+            if (auto observable = oit->second.lock())
+            {
+                //the observable of the element notifies the container
+                detail::access::on_change(*observable)(*it);
+                return;
+            }
+        _on_value_change(*_observed, it);
+        _on_change(*_observed);
+    }
+    
     std::shared_ptr<reference> get_reference(typename Observed::iterator it)
     {
         auto observable = _it2observable[&*it].lock();
@@ -341,21 +381,19 @@ private:
         {
             auto& it2observable = _it2observable;
             auto it_ptr = &*it;
-            observable = std::shared_ptr<reference>
-                (new reference(observable_factory(*it)),
-                 [&it2observable, it_ptr](reference *p)
-                 {
-                     it2observable.erase(it_ptr);
-                     delete p;
-                 });
+            observable = detail::make_element
+                (_observed->get_allocator(),
+                 reference(observable_factory(*it)),
+                 [&it2observable, it_ptr]{ it2observable.erase(it_ptr); });
             auto& container = *this;
-            observable->_on_change.connect(
+            detail::access::on_change(*observable).connect(
                 [&container, it](const typename reference::Observed&)
                 {
                     container._on_value_change(container.get(), it);
                     container._on_change(container.get());
                 });                
             it2observable[&*it] = observable;
+            _on_reference(*observable);
         }
         return observable;
     }
@@ -0,0 +1,153 @@
+#include "observable/map.hpp"
+#include "observable/unordered_map.hpp"
+#include "observable/unordered_set.hpp"
+#include "observable/vector.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+std::size_t allocations{0};
+
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    { std::allocator<T>{}.deallocate(p, n); }
+};
+
+template<typename T, typename U>
+bool operator==(const counting_allocator<T>&, const counting_allocator<U>&)
+{ return true; }
+
+template<typename T, typename U>
+bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&)
+{ return false; }
+
+struct length_hash
+{
+    std::size_t operator()(const std::string& s) const
+    { return s.size(); }
+};
+
+int main()
+{
+    //vector with another allocator
+    {
+        using vector_t = std::vector<int, counting_allocator<int>>;
+        static_assert(std::is_same<observable::observable_of_t<vector_t>,
+                      observable::vector<vector_t>>::value, "");
+        vector_t v;
+        observable::observable_of_t<vector_t> ov(v);
+        bool called{false};
+        ov.on_insert([&called](const vector_t&, vector_t::const_iterator it)
+                     {
+                         assert(*it == 5);
+                         called = true;
+                     });
+        allocations = 0;
+        ov.push_back(5);
+        assert(called);
+        assert(allocations == 1);
+    }
+
+    //observables of elements are allocated by the allocator of the container
+    {
+        using vector_t = std::vector<int, counting_allocator<int>>;
+        vector_t v{1, 2};
+        observable::observable_of_t<vector_t> ov(v);
+        allocations = 0;
+        {
+            auto e = ov[0];
+            e->assign(3);
+            //the observable, the control block and the index node
+            assert(allocations >= 3);
+        }
+        assert(ov._it2observable.empty());
+        assert(v[0] == 3);
+    }
+
+    //map with another comparator and allocator
+    {
+        using map_t = std::map<
+            int, std::string, std::greater<int>,
+            counting_allocator<std::pair<const int, std::string>>>;
+        static_assert(std::is_same<observable::observable_of_t<map_t>,
+                      observable::map<map_t>>::value, "");
+        map_t m;
+        observable::observable_of_t<map_t> om(m);
+        om.emplace(1, "a");
+        om.emplace(2, "b");
+        assert(m.begin()->first == 2);
+        bool called{false};
+        om.on_value_change([&called](const map_t&, map_t::const_iterator it)
+                           {
+                               assert(it->second == "A");
+                               called = true;
+                           });
+        om.find(1)->second->assign("A");
+        assert(called);
+    }
+
+    //unordered_map with another hasher
+    {
+        using map_t = std::unordered_map<std::string, int, length_hash>;
+        static_assert(std::is_same<observable::observable_of_t<map_t>,
+                      observable::unordered_map<map_t>>::value, "");
+        map_t m;
+        observable::observable_of_t<map_t> om(m);
+        om.emplace("abc", 1);
+        om.at("abc")->assign(2);
+        assert(m.at("abc") == 2);
+    }
+
+    //unordered_set with another hasher
+    {
+        using set_t = std::unordered_set<std::string, length_hash>;
+        static_assert(std::is_same<observable::observable_of_t<set_t>,
+                      observable::unordered_set<set_t>>::value, "");
+        set_t s;
+        observable::observable_of_t<set_t> os(s);
+        bool called{false};
+        os.on_insert([&called](const set_t&, set_t::const_iterator)
+                     { called = true; });
+        os.emplace("abc");
+        assert(called);
+        assert(os.count("abc") == 1);
+    }
+
+#ifdef __cpp_lib_generic_associative_lookup
+    //heterogeneous lookup
+    {
+        using map_t = std::map<std::string, int, std::less<>>;
+        map_t m{{"abc", 1}};
+        observable::observable_of_t<map_t> om(m);
+        const char* key = "abc";
+        assert(om.count(key) == 1);
+        om.find(key)->second->assign(2);
+        assert(m.at("abc") == 2);
+        const auto& com = om;
+        assert(com.find(key)->second == 2);
+        assert(om.equal_range(key).first != om.end());
+    }
+#endif
+}
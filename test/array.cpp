@@ -0,0 +1,71 @@
+#include "observable/array.hpp"
+
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+using array_t = std::array<double, 3>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<array_t>,
+                  observable::array<array_t>>::value, "");
+
+    //assign and modify by index
+    {
+        array_t a{{0, 0, 0}};
+        observable::array<array_t> oa(a);
+        std::vector<std::size_t> changed;
+        std::size_t calls{0}, first{0};
+        oa.on_value_change([&changed](const array_t& c,
+                                      array_t::const_iterator it)
+                           { changed.push_back(it - c.begin()); });
+        oa.on_change([&calls](const array_t&){ ++calls; });
+        oa.on_change<0>([&first](const double& v)
+                        {
+                            assert(v == 1.5);
+                            ++first;
+                        });
+        oa.assign<0>(1.5);
+        oa.modify<2>([](double& v){ v += 2; });
+        oa.assign(1, 3.0);
+        oa.modify(1, [](double& v){ v *= 2; });
+        assert((changed == std::vector<std::size_t>{0, 2, 1, 1}));
+        assert(calls == 4);
+        assert(first == 1);
+        assert(oa.get<0>() == 1.5);
+        assert(oa[1] == 6.0);
+        assert(oa.back() == 2.0);
+    }
+
+    //runtime index out of bounds
+    {
+        array_t a{{0, 0, 0}};
+        observable::array<array_t> oa(a);
+        bool ok{false};
+        try { oa.assign(3, 1.0); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+        ok = false;
+        try { oa.modify(3, [](double&){}); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+
+    //fill
+    {
+        array_t a{{0, 0, 0}};
+        observable::array<array_t> oa(a);
+        std::size_t values{0}, calls{0};
+        oa.on_value_change([&values](const array_t&, array_t::const_iterator)
+                           { ++values; });
+        oa.on_change([&calls](const array_t&){ ++calls; });
+        oa.fill(7);
+        assert((a == array_t{{7, 7, 7}}));
+        assert(values == 3);
+        assert(calls == 1);
+        static_assert(observable::array<array_t>::extent == 3, "");
+        assert(oa.size() == 3);
+    }
+}
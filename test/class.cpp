@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 struct foo_t
 {
@@ -15,6 +16,58 @@ using obs_t = observable::class_<
     std::pair<double, d>
     >;
 
+struct payload_t
+{
+    payload_t() = default;
+    payload_t(const payload_t& rhs)
+        : data(rhs.data)
+    { ++copies; }
+    payload_t(payload_t&& rhs) noexcept
+        : data(std::move(rhs.data))
+    { ++moves; }
+    payload_t& operator=(const payload_t& rhs)
+    {
+        data = rhs.data;
+        ++copies;
+        return *this;
+    }
+    payload_t& operator=(payload_t&& rhs) noexcept
+    {
+        data = std::move(rhs.data);
+        ++moves;
+        return *this;
+    }
+    std::string data;
+    static std::size_t copies, moves;
+};
+
+std::size_t payload_t::copies{0};
+std::size_t payload_t::moves{0};
+
+struct bar_t
+{
+    payload_t payload;
+};
+
+struct payload{};
+
+using obar_t = observable::class_<
+    bar_t,
+    std::pair<payload_t, payload>
+    >;
+
+struct point_t
+{ double x, y; };
+
+struct x{};
+struct y{};
+
+using opoint_t = observable::class_<
+    point_t,
+    std::pair<double, x>,
+    std::pair<double, y>
+    >;
+
 int main()
 {
     //move ctor
@@ -33,4 +86,92 @@ int main()
         obs2 = std::move(obs);
         obs2.assign<d>(4.5);
     }
+    
+    //assign lvalue copies once
+    {
+        bar_t bar;
+        obar_t obar(bar, bar.payload);
+        payload_t p;
+        p.data = "abc";
+        payload_t::copies = payload_t::moves = 0;
+        obar.assign<payload>(p);
+        assert(payload_t::copies == 1);
+        assert(payload_t::moves == 0);
+        assert(bar.payload.data == "abc");
+    }
+    
+    //assign rvalue moves once
+    {
+        bar_t bar;
+        obar_t obar(bar, bar.payload);
+        payload_t p;
+        p.data = "abc";
+        payload_t::copies = payload_t::moves = 0;
+        obar.assign<payload>(std::move(p));
+        assert(payload_t::copies == 0);
+        assert(payload_t::moves == 1);
+        assert(bar.payload.data == "abc");
+    }
+    
+    //modify
+    {
+        bar_t bar;
+        obar_t obar(bar, bar.payload);
+        bool member_called{false}, called{false};
+        obar.on_change<payload>([&member_called](const payload_t& p)
+                                {
+                                    assert(p.data == "abc");
+                                    member_called = true;
+                                });
+        obar.on_change([&called](const bar_t&){ called = true; });
+        payload_t::copies = payload_t::moves = 0;
+        obar.modify<payload>([](payload_t& p){ p.data += "abc"; });
+        assert(payload_t::copies == 0);
+        assert(payload_t::moves == 0);
+        assert(member_called);
+        assert(called);
+    }
+
+    //on_member_change
+    {
+        point_t point;
+        opoint_t opoint(point, point.x, point.y);
+        std::vector<std::size_t> members;
+        opoint.on_member_change(
+            [&members](const point_t&, std::size_t member)
+            { members.push_back(member); });
+        opoint.assign<y>(1.5);
+        opoint.assign<x>(2.5);
+        assert((members == std::vector<std::size_t>
+                {opoint_t::index<y>(), opoint_t::index<x>()}));
+        assert(opoint_t::index<x>() == 0);
+        assert(opoint_t::index<y>() == 1);
+    }
+
+    //on_member_change after move
+    {
+        point_t point;
+        opoint_t opoint(point, point.x, point.y);
+        std::size_t member{2};
+        opoint.on_member_change([&member](const point_t&, std::size_t m)
+                                { member = m; });
+        auto opoint2 = std::move(opoint);
+        opoint2.assign<y>(1.5);
+        assert(member == opoint_t::index<y>());
+    }
+
+    //on_change_any
+    {
+        point_t point;
+        opoint_t opoint(point, point.x, point.y);
+        std::size_t x_calls{0}, xy_calls{0};
+        opoint.on_change_any<x>([&x_calls](const point_t&){ ++x_calls; });
+        opoint.on_change_any<x, y>([&xy_calls](const point_t&){ ++xy_calls; });
+        opoint.assign<y>(1.5);
+        assert(x_calls == 0);
+        assert(xy_calls == 1);
+        opoint.assign<x>(2.5);
+        assert(x_calls == 1);
+        assert(xy_calls == 2);
+    }
 }
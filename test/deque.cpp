@@ -0,0 +1,83 @@
+#include "observable/deque.hpp"
+
+#include <cassert>
+#include <deque>
+#include <stdexcept>
+#include <vector>
+
+using deque_t = std::deque<int>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<deque_t>,
+                  observable::deque<deque_t>>::value, "");
+
+    //push at both ends
+    {
+        deque_t d;
+        observable::deque<deque_t> od(d);
+        std::vector<int> inserted;
+        std::size_t calls{0};
+        od.on_insert([&inserted](const deque_t&, deque_t::const_iterator it)
+                     { inserted.push_back(*it); });
+        od.on_change([&calls](const deque_t&){ ++calls; });
+        od.push_back(2);
+        od.push_front(1);
+        od.emplace_back(3);
+        od.emplace_front(0);
+        assert((inserted == std::vector<int>{2, 1, 3, 0}));
+        assert((d == deque_t{0, 1, 2, 3}));
+        assert(calls == 4);
+        assert(od.front() == 0);
+        assert(od.back() == 3);
+        assert(od[1] == 1);
+    }
+
+    //pop at both ends
+    {
+        deque_t d{0, 1, 2, 3};
+        observable::deque<deque_t> od(d);
+        std::vector<int> before;
+        std::size_t erased{0};
+        od.before_erase([&before](const deque_t&, deque_t::const_iterator it)
+                        { before.push_back(*it); });
+        od.on_erase([&erased](const deque_t&, deque_t::const_iterator)
+                    { ++erased; });
+        od.pop_front();
+        od.pop_back();
+        assert((before == std::vector<int>{0, 3}));
+        assert(erased == 2);
+        assert((d == deque_t{1, 2}));
+    }
+
+    //modify
+    {
+        deque_t d{0, 1};
+        observable::deque<deque_t> od(d);
+        bool called{false};
+        od.on_value_change([&called](const deque_t&, deque_t::const_iterator it)
+                           {
+                               assert(*it == 10);
+                               called = true;
+                           });
+        od.modify(1, [](int& i){ i *= 10; });
+        assert(called);
+        bool ok{false};
+        try { od.modify(2, [](int&){}); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+
+    //erase and clear
+    {
+        deque_t d{0, 1, 2};
+        observable::deque<deque_t> od(d);
+        std::size_t calls{0};
+        od.on_change([&calls](const deque_t&){ ++calls; });
+        od.erase(od.cbegin() + 1);
+        assert((d == deque_t{0, 2}));
+        od.clear();
+        assert(od.empty());
+        assert(calls == 2);
+    }
+}
@@ -0,0 +1,123 @@
+#include "observable/class.hpp"
+#include "observable/setter_value.hpp"
+#include "observable/value.hpp"
+#include "observable/variant.hpp"
+
+#include <cmath>
+#include <string>
+
+using namespace observable;
+
+struct approx_equal
+{
+    bool operator()(double a, double b) const noexcept
+    { return std::abs(a - b) < 0.01; }
+};
+
+struct quote_t
+{
+    double price;
+    std::string symbol;
+    int volume;
+};
+
+struct price{};
+struct symbol{};
+struct volume{};
+
+using oquote_t = class_<
+    quote_t,
+    std::pair<distinct<double, approx_equal>, price>,
+    std::pair<distinct<std::string>, symbol>,
+    std::pair<int, volume>
+    >;
+
+struct foo_t {
+    void val(float v)
+    { _v = v; }
+    
+    const float& val() const noexcept
+    { return _v; }
+private:
+    float _v{0};
+};
+
+int main()
+{
+    //value
+    {
+        std::string s{"abc"};
+        value<std::string, std::equal_to<std::string>> os(s);
+        std::size_t called{0};
+        os.on_change([&called](const std::string&){ ++called; });
+        os = "abc";
+        assert(called == 0);
+        os = "def";
+        assert(called == 1);
+        assert(s == "def");
+    }
+
+    //value with custom comparator
+    {
+        double d{1.0};
+        value<double, approx_equal> od(d);
+        std::size_t called{0};
+        od.on_change([&called](double){ ++called; });
+        od = 1.001;
+        assert(called == 0);
+        assert(d == 1.0);
+        od = 1.5;
+        assert(called == 1);
+        assert(d == 1.5);
+    }
+    
+    //class_ members
+    {
+        quote_t quote{10.0, "abc", 1};
+        oquote_t oquote(quote, quote.price, quote.symbol, quote.volume);
+        std::size_t quote_called{0}, price_called{0};
+        oquote.on_change([&quote_called](const quote_t&){ ++quote_called; });
+        oquote.on_change<price>([&price_called](double){ ++price_called; });
+        oquote.assign<price>(10.001);
+        oquote.assign<symbol>("abc");
+        assert(quote_called == 0);
+        assert(price_called == 0);
+        oquote.assign<price>(11.0);
+        assert(quote_called == 1);
+        assert(price_called == 1);
+        oquote.assign<symbol>("def");
+        assert(quote_called == 2);
+        oquote.assign<volume>(1);
+        assert(quote_called == 3);
+    }
+    
+    //setter_value
+    {
+        foo_t foo;
+        using sg_t = set_get<float>;
+        setter_value<sg_t, std::equal_to<float>> ofoo(
+            sg_t{[&foo](float v){ foo.val(v); },
+                 [&foo]() -> const float& { return foo.val(); }});
+        std::size_t called{0};
+        ofoo.on_change([&called](float){ ++called; });
+        ofoo = 0.f;
+        assert(called == 0);
+        ofoo = 1.f;
+        assert(called == 1);
+    }
+    
+    //variant
+    {
+        using variant_t = boost::variant<int, std::string>;
+        variant_t v{1};
+        variant<variant_t, std::equal_to<variant_t>> ov(v);
+        std::size_t called{0};
+        ov.on_change([&called](const variant_t&){ ++called; });
+        ov = 1;
+        assert(called == 0);
+        ov = std::string("abc");
+        assert(called == 1);
+        ov = std::string("abc");
+        assert(called == 1);
+    }
+}
@@ -0,0 +1,222 @@
+#include "observable/class.hpp"
+#include "observable/flat_map.hpp"
+#include "observable/observable_is_class.hpp"
+
+#include <boost/container/flat_map.hpp>
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+using map_t = boost::container::flat_map<int, std::string>;
+
+struct kid_t
+{
+    std::string name;
+    std::size_t age;
+};
+
+struct name{};
+struct age{};
+
+using okid_t = observable::class_<
+    kid_t,
+    std::pair<std::string, name>,
+    std::pair<std::size_t, age>
+    >;
+
+okid_t observable_factory(kid_t& model)
+{ return okid_t(model, model.name, model.age); }
+
+OBSERVABLE_IS_CLASS(okid_t)
+
+using kids_t = boost::container::flat_map<int, kid_t>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<map_t>,
+                  observable::flat_map<map_t>>::value, "");
+    static_assert(std::is_same<observable::flat_map<map_t>::reference,
+                  observable::value<std::string>>::value, "");
+    static_assert(std::is_same<observable::flat_map<kids_t>::reference,
+                  okid_t>::value, "");
+
+    //at fail
+    {
+        map_t map;
+        observable::flat_map<map_t> omap(map);
+        bool ok{false};
+        try { omap.at(0); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+
+    //at success
+    {
+        map_t map{{2, "abc"}};
+        observable::flat_map<map_t> omap(map);
+        bool called{false}, value_called{false};
+        omap.on_value_change([&value_called](const map_t&,
+                                             map_t::const_iterator it)
+                             {
+                                 assert(it->first == 2);
+                                 value_called = true;
+                             });
+        auto o = omap.at(2);
+        assert(o->get() == "abc");
+        o->on_change([&called](const std::string&){ called = true; });
+        o->assign("def");
+        assert(map.at(2) == "def");
+        assert(called);
+        assert(value_called);
+    }
+
+    //operator[] inserts
+    {
+        map_t map;
+        observable::flat_map<map_t> omap(map);
+        bool inserted{false};
+        omap.on_insert([&inserted](const map_t&, map_t::const_iterator it)
+                       {
+                           assert(it->first == 1);
+                           inserted = true;
+                       });
+        auto o = omap[1];
+        assert(inserted);
+        assert(o->get().empty());
+    }
+
+    //the observable of an element survives insertions and erasures
+    {
+        map_t map{{5, "five"}};
+        observable::flat_map<map_t> omap(map);
+        auto o = omap.at(5);
+        std::size_t calls{0};
+        o->on_change([&calls](const std::string&){ ++calls; });
+        for (int i = 0; i < 5; ++i) omap.emplace(i, "small");
+        omap.erase(0);
+        assert(o->get() == "five");
+        o->assign("FIVE");
+        assert(map.at(5) == "FIVE");
+        assert(calls == 1);
+        assert(omap.at(5) == o);
+    }
+
+    //the observable of a class element is rebuilt when the element
+    //moves
+    {
+        kids_t kids{{5, {"lucas", 3}}};
+        observable::flat_map<kids_t> okids(kids);
+        auto o = okids.at(5);
+        std::size_t calls{0}, value_calls{0};
+        o->on_change([&calls](const kid_t&){ ++calls; });
+        okids.on_value_change([&value_calls](const kids_t&,
+                                             kids_t::const_iterator it)
+                              {
+                                  assert(it->first == 5);
+                                  ++value_calls;
+                              });
+        for (int i = 0; i < 5; ++i) okids.emplace(i, kid_t{"ana", 1});
+        okids.reserve(64);
+        okids.erase(0);
+        assert(o->get().name == "lucas");
+        o->assign<name>("LUCAS");
+        assert(kids.at(5).name == "LUCAS");
+        assert(calls == 1);
+        assert(value_calls == 1);
+        assert(okids.at(5) == o);
+        assert(okids._it2observable.size() == 1);
+    }
+
+    //the observable of an element is released
+    {
+        map_t map{{1, "a"}};
+        observable::flat_map<map_t> omap(map);
+        omap.at(1);
+        assert(omap._it2observable.empty());
+    }
+
+    //modify
+    {
+        map_t map{{1, "a"}};
+        observable::flat_map<map_t> omap(map);
+        bool called{false};
+        omap.on_change([&called](const map_t&){ called = true; });
+        omap.modify(1, [](std::string& s){ s += "b"; });
+        assert(map.at(1) == "ab");
+        assert(called);
+        bool ok{false};
+        try { omap.modify(2, [](std::string&){}); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+
+    //modify with an alive observable of the element
+    {
+        map_t map{{1, "a"}};
+        observable::flat_map<map_t> omap(map);
+        auto o = omap.at(1);
+        std::size_t element_calls{0}, calls{0};
+        o->on_change([&element_calls](const std::string&){ ++element_calls; });
+        omap.on_change([&calls](const map_t&){ ++calls; });
+        omap.modify(1, [](std::string& s){ s += "b"; });
+        assert(element_calls == 1);
+        assert(calls == 1);
+    }
+
+    //erase
+    {
+        map_t map{{1, "a"}, {2, "b"}};
+        observable::flat_map<map_t> omap(map);
+        bool before{false}, erased{false};
+        omap.before_erase([&before](const map_t&, map_t::const_iterator it)
+                          {
+                              assert(it->first == 1);
+                              before = true;
+                          });
+        omap.on_erase([&erased](const map_t&, map_t::const_iterator)
+                      { erased = true; });
+        assert(omap.erase(1) == 1);
+        assert(omap.erase(1) == 0);
+        assert(before);
+        assert(erased);
+        assert(map.size() == 1);
+    }
+
+    //clear
+    {
+        map_t map{{1, "a"}, {2, "b"}};
+        observable::flat_map<map_t> omap(map);
+        bool called{false};
+        omap.on_change([&called](const map_t&){ called = true; });
+        omap.clear();
+        assert(map.empty());
+        assert(called);
+    }
+
+    //insert
+    {
+        map_t map;
+        observable::flat_map<map_t> omap(map);
+        std::size_t calls{0};
+        omap.on_insert([&calls](const map_t&, map_t::const_iterator)
+                       { ++calls; });
+        assert(omap.insert(map_t::value_type(1, "a")).second);
+        assert(!omap.insert(map_t::value_type(1, "b")).second);
+        omap.insert({{2, "b"}, {3, "c"}});
+        assert(calls == 2);
+        assert(map.size() == 3);
+    }
+
+    //iteration
+    {
+        map_t map{{1, "a"}, {2, "b"}};
+        observable::flat_map<map_t> omap(map);
+        std::string s;
+        for (auto it = omap.begin(); it != omap.end(); ++it)
+            s += it->second->get();
+        assert(s == "ab");
+        assert(omap.find(2)->second->get() == "b");
+        assert(omap.count(2) == 1);
+    }
+}
@@ -0,0 +1,195 @@
+#include "observable/class.hpp"
+#include "observable/lazy_class.hpp"
+#include "observable/observable_class_gen.hpp"
+#include "observable/observable_is_class.hpp"
+#include "observable/setter_value.hpp"
+#include "observable/vector.hpp"
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+struct address_t
+{ std::string street; };
+
+struct street{};
+
+using oaddress_t = observable::class_<
+    address_t,
+    std::pair<std::string, street>
+    >;
+
+std::size_t factory_calls{0};
+
+inline oaddress_t observable_factory(address_t& model)
+{
+    ++factory_calls;
+    return oaddress_t(model, model.street);
+}
+
+OBSERVABLE_IS_CLASS(oaddress_t)
+
+struct person_t
+{
+    std::string name;
+    std::size_t age;
+    address_t address;
+    std::vector<std::string> kids;
+};
+
+OBSERVABLE_LAZY_CLASS_GEN(
+    operson_t,
+    person_t,
+    ((std::string, name))
+    ((observable::distinct<std::size_t>, age))
+    ((address_t, address))
+    ((std::vector<std::string>, kids))
+);
+
+int main()
+{
+    //the members are constructed on first use
+    {
+        person_t person{"maria", 26, {}, {}};
+        factory_calls = 0;
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        assert(factory_calls == 0);
+        operson.get<name>();
+        assert(factory_calls == 0);
+        operson.get<address>();
+        assert(factory_calls == 1);
+        operson.get<address>();
+        assert(factory_calls == 1);
+    }
+
+    //assign creates the member and notifies the class
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        std::size_t calls{0};
+        operson.on_change([&calls](const person_t& p)
+                          {
+                              assert(p.name == "joana");
+                              ++calls;
+                          });
+        operson.assign<name>("joana");
+        assert(person.name == "joana");
+        assert(calls == 1);
+    }
+
+    //the equality policy of a member is used
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        std::size_t calls{0};
+        operson.on_change([&calls](const person_t&){ ++calls; });
+        operson.assign<age>(26u);
+        assert(calls == 0);
+        operson.assign<age>(27u);
+        assert(calls == 1);
+    }
+
+    //nested class and container members
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        std::size_t calls{0};
+        operson.on_change([&calls](const person_t&){ ++calls; });
+        operson.get<address>().assign<street>("rua a");
+        operson.get<kids>().push_back("lucas");
+        assert(person.address.street == "rua a");
+        assert(person.kids.size() == 1);
+        assert(calls == 2);
+    }
+
+    //move ctor keeps the members and their connections
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        bool member_called{false};
+        operson.on_change<name>([&member_called](const std::string&)
+                                { member_called = true; });
+        auto operson2 = std::move(operson);
+        std::size_t calls{0};
+        operson2.on_change([&calls](const person_t&){ ++calls; });
+        operson2.assign<name>("joana");
+        operson2.assign<age>(30u);
+        assert(member_called);
+        assert(calls == 2);
+    }
+
+    //move operator assignment
+    {
+        person_t person{"maria", 26, {}, {}}, person2;
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        operson_t operson2(person2, person2.name, person2.age,
+                           person2.address, person2.kids);
+        operson.get<name>();
+        operson2.get<name>();
+        operson2 = std::move(operson);
+        std::size_t calls{0};
+        operson2.on_change([&calls](const person_t&){ ++calls; });
+        operson2.assign<name>("joana");
+        assert(person.name == "joana");
+        assert(calls == 1);
+    }
+
+    //set_get member
+    {
+        struct foo_t
+        {
+            void set(int v) { _v = v; }
+            int get() const { return _v; }
+            int _v{0};
+        };
+        struct bar_t{ foo_t foo; };
+        struct v{};
+        using set_get_t = observable::set_get<
+            int, std::function<void(int)>, std::function<int()>>;
+        using obar_t = observable::lazy_class_<
+            bar_t,
+            std::pair<set_get_t, v>>;
+        bar_t bar;
+        obar_t obar(bar, set_get_t{[&bar](int i){ bar.foo.set(i); },
+                                   [&bar]{ return bar.foo.get(); }});
+        bool called{false};
+        obar.on_change([&called](const bar_t&){ called = true; });
+        obar.assign<v>(5);
+        assert(bar.foo.get() == 5);
+        assert(called);
+    }
+
+    //on_member_change
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        std::size_t member{0};
+        operson.on_member_change([&member](const person_t&, std::size_t m)
+                                 { member = m; });
+        operson.get<kids>().push_back("lucas");
+        assert(member == operson_t::index<kids>());
+        operson.assign<age>(30u);
+        assert(member == operson_t::index<age>());
+    }
+
+    //on_change_any
+    {
+        person_t person{"maria", 26, {}, {}};
+        operson_t operson(person, person.name, person.age,
+                          person.address, person.kids);
+        std::size_t calls{0};
+        operson.on_change_any<name, age>([&calls](const person_t&)
+                                         { ++calls; });
+        operson.assign<name>("joana");
+        operson.assign<age>(30u);
+        operson.get<kids>().push_back("lucas");
+        assert(calls == 2);
+    }
+}
@@ -0,0 +1,84 @@
+#include "observable/class.hpp"
+#include "observable/map.hpp"
+#include "observable/unordered_map.hpp"
+#include "observable/unordered_set.hpp"
+#include "observable/value.hpp"
+#include "observable/variant.hpp"
+#include "observable/vector.hpp"
+
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::size_t allocations{0};
+
+void* operator new(std::size_t n)
+{
+    ++allocations;
+    if (auto p = std::malloc(n)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{ std::free(p); }
+
+using namespace observable;
+
+int main()
+{
+    static_assert(sizeof(detail::lazy_signal<void()>) == sizeof(void*),
+                  "lazy_signal must have the size of a pointer");
+    
+    //no allocations without slots
+    {
+        int i{0};
+        std::vector<std::vector<int>> vv{{1, 2}, {3}};
+        vv.reserve(3);
+        std::map<int, std::string> m{{1, "abc"}};
+        std::unordered_map<int, std::string> um{{1, "abc"}};
+        std::unordered_set<int> us{1};
+        boost::variant<int, std::string> var{1};
+        
+        auto before = allocations;
+        value<int> oi(i);
+        oi = 2;
+        vector<std::vector<std::vector<int>>> ovv(vv);
+        ovv.push_back({});
+        map<std::map<int, std::string>> om(m);
+        om.erase(1);
+        unordered_map<std::unordered_map<int, std::string>> oum(um);
+        oum.modify(1, [](std::string& s){ s = "def"; });
+        unordered_set<std::unordered_set<int>> ous(us);
+        ous.erase(1);
+        variant<boost::variant<int, std::string>> ovar(var);
+        ovar = 2;
+        assert(allocations == before);
+    }
+
+    //first connect allocates
+    {
+        int i{0};
+        value<int> oi(i);
+        auto before = allocations;
+        bool called{false};
+        oi.on_change([&called](int){ called = true; });
+        assert(allocations > before);
+        assert(!oi._on_change.empty());
+        oi = 1;
+        assert(called);
+    }
+    
+    //move
+    {
+        int i{0};
+        value<int> oi(i);
+        bool called{false};
+        oi.on_change([&called](int){ called = true; });
+        value<int> oi2(std::move(oi));
+        assert(oi._on_change.empty());
+        oi2 = 1;
+        assert(called);
+    }
+}
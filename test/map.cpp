@@ -5,6 +5,7 @@
 #include <iostream>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 using map_t = std::map<std::size_t, std::string>;
 
@@ -443,4 +444,203 @@ int main()
         assert((--it)->first == 2);
     }
     
+    //merge upsert
+    {
+        map.clear();
+        map.emplace(1, "abc");
+        map.emplace(3, "def");
+        std::size_t inserted{0}, updated{0}, changed{0};
+        boost::signals2::scoped_connection c1 =
+            obs.on_insert([&inserted](const map_t&, map_t::const_iterator it)
+                          {
+                              assert(it->first == 2);
+                              ++inserted;
+                          });
+        boost::signals2::scoped_connection c2 =
+            obs.on_value_change([&updated](const map_t&,
+                                           map_t::const_iterator it)
+                                {
+                                    assert(it->first == 3);
+                                    ++updated;
+                                });
+        boost::signals2::scoped_connection c3 =
+            obs.on_change([&changed](const map_t&){ ++changed; });
+        map_t source{{2, "ghi"}, {3, "DEF"}};
+        auto ret = obs.merge(source);
+        assert(ret.inserted == 1);
+        assert(ret.updated == 1);
+        assert(ret.erased == 0);
+        assert(inserted == 1);
+        assert(updated == 1);
+        assert(changed == 1);
+        assert((map == map_t{{1, "abc"}, {2, "ghi"}, {3, "DEF"}}));
+        assert(source.size() == 2);
+    }
+    
+    //merge replace
+    {
+        map.clear();
+        map.emplace(1, "abc");
+        map.emplace(3, "def");
+        map.emplace(5, "jkl");
+        std::size_t erased{0}, changed{0};
+        boost::signals2::scoped_connection c1 =
+            obs.on_erase([&erased](const map_t&, map_t::const_iterator)
+                         { ++erased; });
+        boost::signals2::scoped_connection c2 =
+            obs.on_change([&changed](const map_t&){ ++changed; });
+        observable::merge_result merged;
+        std::size_t merges{0};
+        boost::signals2::scoped_connection c3 =
+            obs.on_merge([&](const map_t&, const observable::merge_result& r)
+                         {
+                             assert(changed == 1);
+                             merged = r;
+                             ++merges;
+                         });
+        auto ret = obs.merge(map_t{{2, "ghi"}, {3, "def"}},
+                             observable::merge_policy::replace,
+                             std::equal_to<std::string>{});
+        assert(ret.inserted == 1);
+        assert(ret.updated == 0);
+        assert(ret.erased == 2);
+        assert(erased == 2);
+        assert(changed == 1);
+        assert(merges == 1);
+        assert(merged.inserted == 1 && merged.updated == 0
+               && merged.erased == 2);
+        assert((map == map_t{{2, "ghi"}, {3, "def"}}));
+    }
+    
+    //merge without changes
+    {
+        map.clear();
+        map.emplace(1, "abc");
+        bool called{false};
+        boost::signals2::scoped_connection c =
+            obs.on_change([&called](const map_t&){ called = true; });
+        boost::signals2::scoped_connection c2 =
+            obs.on_merge([&called](const map_t&, const observable::merge_result&)
+                         { called = true; });
+        auto ret = obs.merge(map_t{{1, "abc"}},
+                             observable::merge_policy::replace,
+                             std::equal_to<std::string>{});
+        assert(!ret.changed());
+        assert(!called);
+    }
+    
+    //merge notifies the observable of an updated value
+    {
+        map_t m{{1, "a"}, {2, "b"}};
+        observable::map<map_t> om(m);
+        std::size_t element_calls{0}, value_changes{0}, changes{0};
+        std::string last;
+        auto e = om.at(1);
+        e->on_change([&element_calls, &last](const std::string& s)
+                     {
+                         last = s;
+                         ++element_calls;
+                     });
+        om.on_value_change([&value_changes](const map_t&,
+                                            map_t::const_iterator)
+                           { ++value_changes; });
+        om.on_change([&changes](const map_t&){ ++changes; });
+        auto ret = om.merge(map_t{{1, "x"}, {2, "y"}});
+        assert(ret.updated == 2);
+        assert(element_calls == 1 && last == "x");
+        assert(value_changes == 2);
+        assert(changes == 1);
+        e->assign("z");
+        assert(element_calls == 2 && changes == 2);
+    }
+    
+    //modify
+    {
+        map.clear();
+        map.emplace(2, "abc");
+        bool value_changed{false}, changed{false};
+        boost::signals2::scoped_connection c1 =
+            obs.on_value_change([&value_changed](const map_t&,
+                                                 map_t::const_iterator it)
+                                {
+                                    assert(it->first == 2);
+                                    assert(it->second == "ABC");
+                                    value_changed = true;
+                                });
+        boost::signals2::scoped_connection c2 =
+            obs.on_change([&changed](const map_t&){ changed = true; });
+        obs.modify(2, [](std::string& s){ s = "ABC"; });
+        assert(value_changed);
+        assert(changed);
+        assert(obs._it2observable.empty());
+        bool ok{false};
+        try
+        { obs.modify(0, [](std::string&){}); }
+        catch(const std::out_of_range&)
+        { ok = true; }
+        assert(ok);
+    }
+    
+    //on_range_change
+    {
+        map_t m;
+        obs_t om(m);
+        std::vector<std::size_t> low, mid;
+        boost::signals2::scoped_connection c1 =
+            om.on_range_change(0, 10,
+                               [&low](const map_t&, const std::size_t& k)
+                                { low.push_back(k); });
+        boost::signals2::scoped_connection c2 =
+            om.on_range_change(5, 20,
+                               [&mid](const map_t&, const std::size_t& k)
+                                { mid.push_back(k); });
+        om.emplace(1, "a");
+        om.insert(map_t::value_type(7, "b"));
+        om.emplace(30, "c");
+        om.emplace(20, "d");
+        om.modify(7, [](std::string& s){ s = "B"; });
+        om.at(20)->assign("D");
+        om.erase(1);
+        assert((low == std::vector<std::size_t>{1, 7, 7, 1}));
+        assert((mid == std::vector<std::size_t>{7, 20, 7, 20}));
+        c1.disconnect();
+        om.insert({{5, "e"}, {6, "f"}});
+        assert((low == std::vector<std::size_t>{1, 7, 7, 1}));
+        assert((mid == std::vector<std::size_t>{7, 20, 7, 20, 5, 6}));
+        mid.clear();
+        om.clear();
+        assert((mid == std::vector<std::size_t>{5, 6, 7, 20}));
+        bool ok{false};
+        try
+        { om.on_range_change(2, 1, [](const map_t&, const std::size_t&){}); }
+        catch(const std::invalid_argument&)
+        { ok = true; }
+        assert(ok);
+    }
+
+    //erase(key) and swap notify each change once
+    {
+        map_t m{{1, "a"}, {7, "b"}};
+        obs_t om(m);
+        std::size_t before{0}, erased{0}, changes{0};
+        std::vector<std::size_t> keys;
+        om.before_erase([&before](const map_t&, map_t::const_iterator)
+                        { ++before; });
+        om.on_erase([&erased](const map_t&, map_t::const_iterator)
+                    { ++erased; });
+        om.on_change([&changes](const map_t&){ ++changes; });
+        om.on_range_change(0, 10,
+                           [&keys](const map_t&, const std::size_t& k)
+                           { keys.push_back(k); });
+        assert(om.erase(1) == 1);
+        assert(before == 1 && erased == 1 && changes == 1);
+        assert((keys == std::vector<std::size_t>{1}));
+        assert(om.erase(1) == 0);
+        assert(before == 1 && erased == 1 && changes == 1);
+        keys.clear();
+        map_t other{{2, "c"}, {7, "B"}};
+        om.swap(other);
+        assert(before == 2 && erased == 2 && changes == 2);
+        assert((keys == std::vector<std::size_t>{2, 7}));
+    }
 }
@@ -0,0 +1,105 @@
+#include "observable/class.hpp"
+#include "observable/multimap.hpp"
+#include "observable/observable_is_class.hpp"
+
+#include <cassert>
+#include <map>
+#include <string>
+#include <vector>
+
+using multimap_t = std::multimap<int, std::string>;
+
+struct foo_t{ std::string s; };
+struct s{};
+using ofoo_t = observable::class_<
+    foo_t,
+    std::pair<std::string, s>
+    >;
+
+ofoo_t observable_factory(foo_t& model)
+{ return ofoo_t(model, model.s); }
+
+OBSERVABLE_IS_CLASS(ofoo_t)
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<multimap_t>,
+                  observable::multimap<multimap_t>>::value, "");
+
+    //every insertion inserts
+    {
+        multimap_t m;
+        observable::multimap<multimap_t> om(m);
+        std::vector<std::string> inserted;
+        std::size_t calls{0};
+        auto conn = om.on_insert([&inserted](const multimap_t&,
+                                             multimap_t::const_iterator it)
+                                 { inserted.push_back(it->second); });
+        om.on_change([&calls](const multimap_t&){ ++calls; });
+        om.insert({1, "a"});
+        om.emplace(1, "b");
+        om.emplace_hint(om.cend(), 2, "c");
+        assert((inserted == std::vector<std::string>{"a", "b", "c"}));
+        assert(calls == 3);
+        //a range insertion is notified without a position
+        conn.disconnect();
+        om.insert({{3, "d"}, {3, "e"}});
+        assert(calls == 4);
+        assert(om.count(1) == 2);
+        assert(om.count(3) == 2);
+    }
+
+    //observables of the elements with equivalent keys
+    {
+        multimap_t m{{1, "a"}, {1, "b"}};
+        observable::multimap<multimap_t> om(m);
+        std::vector<std::string> changed;
+        om.on_value_change([&changed](const multimap_t&,
+                                      multimap_t::const_iterator it)
+                           { changed.push_back(it->second); });
+        auto rng = om.equal_range(1);
+        auto first = (*rng.first).second;
+        auto second = (*std::next(rng.first)).second;
+        first->assign("x");
+        second->assign("y");
+        assert((changed == std::vector<std::string>{"x", "y"}));
+        assert(m.begin()->second == "x");
+        assert(std::next(m.begin())->second == "y");
+        assert((*om.lower_bound(1)).second == first);
+        assert(om.upper_bound(1) == om.end());
+    }
+
+    //erase by key erases every equivalent element
+    {
+        multimap_t m{{1, "a"}, {1, "b"}, {2, "c"}};
+        observable::multimap<multimap_t> om(m);
+        std::size_t before{0}, erased{0};
+        om.before_erase([&before](const multimap_t&,
+                                  multimap_t::const_iterator)
+                        { ++before; });
+        om.on_erase([&erased](const multimap_t&, multimap_t::const_iterator)
+                    { ++erased; });
+        assert(om.erase(1) == 2);
+        assert(om.erase(1) == 0);
+        assert(before == 1 && erased == 1);
+        om.erase(om.cbegin());
+        assert(om.empty());
+    }
+
+    //changes of a member of a class element are notified by the
+    //container
+    {
+        using foo_multimap_t = std::multimap<int, foo_t>;
+        foo_multimap_t m{{1, foo_t{"a"}}};
+        observable::multimap<foo_multimap_t> om(m);
+        std::size_t changes{0}, value_changes{0};
+        om.on_change([&changes](const foo_multimap_t&){ ++changes; });
+        om.on_value_change([&value_changes](const foo_multimap_t&,
+                                            foo_multimap_t::const_iterator)
+                           { ++value_changes; });
+        auto e = (*om.begin()).second;
+        e->get<s>().assign("b");
+        assert(m.begin()->second.s == "b");
+        assert(changes == 1 && value_changes == 1);
+    }
+}
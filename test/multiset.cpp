@@ -0,0 +1,55 @@
+#include "observable/multiset.hpp"
+
+#include <cassert>
+#include <set>
+#include <vector>
+
+using multiset_t = std::multiset<int>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<multiset_t>,
+                  observable::multiset<multiset_t>>::value, "");
+
+    //every insertion inserts
+    {
+        multiset_t s;
+        observable::multiset<multiset_t> os(s);
+        std::vector<int> inserted;
+        std::size_t calls{0};
+        auto conn = os.on_insert([&inserted](const multiset_t&,
+                                             multiset_t::const_iterator it)
+                                 { inserted.push_back(*it); });
+        os.on_change([&calls](const multiset_t&){ ++calls; });
+        os.insert(1);
+        os.insert(1);
+        os.emplace(2);
+        os.emplace_hint(os.cend(), 2);
+        assert((inserted == std::vector<int>{1, 1, 2, 2}));
+        assert(calls == 4);
+        //a range insertion is notified without a position
+        conn.disconnect();
+        os.insert({3, 3});
+        assert(calls == 5);
+        std::vector<int> none;
+        os.insert(none.begin(), none.end());
+        assert(calls == 5);
+        assert(os.count(3) == 2);
+    }
+
+    //erase by key erases every equivalent element
+    {
+        multiset_t s{1, 2, 2, 3};
+        observable::multiset<multiset_t> os(s);
+        std::size_t erased{0};
+        os.on_erase([&erased](const multiset_t&, multiset_t::const_iterator)
+                    { ++erased; });
+        assert(os.erase(2) == 2);
+        assert(os.erase(2) == 0);
+        assert(erased == 1);
+        assert((s == multiset_t{1, 3}));
+        os.clear();
+        assert(os.empty());
+        assert(erased == 2);
+    }
+}
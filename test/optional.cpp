@@ -0,0 +1,174 @@
+#include "observable/class.hpp"
+#include "observable/observable_is_class.hpp"
+#include "observable/optional.hpp"
+#include "observable/variant.hpp"
+#include "observable/vector.hpp"
+
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct foo_t{ int i; };
+struct i{};
+using ofoo_t = observable::class_<
+    foo_t,
+    std::pair<int, i>>;
+
+ofoo_t observable_factory(foo_t& o)
+{ return ofoo_t(o, o.i); }
+
+OBSERVABLE_IS_CLASS(ofoo_t)
+
+using optional_t = boost::optional<std::string>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<optional_t>,
+                  observable::optional<optional_t>>::value, "");
+
+    //engage, change and disengage
+    {
+        optional_t o;
+        observable::optional<optional_t> oo(o);
+        std::size_t engaged{0}, disengaged{0}, changed{0};
+        oo.on_engage([&engaged](const optional_t& o)
+                     {
+                         assert(*o == "abc");
+                         ++engaged;
+                     });
+        oo.on_disengage([&disengaged](const optional_t& o)
+                        {
+                            assert(!o);
+                            ++disengaged;
+                        });
+        oo.on_change([&changed](const optional_t&){ ++changed; });
+        assert(!oo);
+        oo = optional_t("abc");
+        assert(oo.has_value());
+        assert(engaged == 1 && changed == 1);
+        oo = optional_t("def");
+        assert(engaged == 1 && changed == 2);
+        oo.reset();
+        assert(!o);
+        assert(disengaged == 1 && changed == 3);
+        oo.reset();
+        assert(changed == 3);
+    }
+
+    //the slots of the observable of the value are kept across
+    //engagements
+    {
+        optional_t o("abc");
+        observable::optional<optional_t> oo(o);
+        std::size_t value_changed{0}, changed{0};
+        oo->on_change([&value_changed](const std::string&)
+                      { ++value_changed; });
+        oo.on_change([&changed](const optional_t&){ ++changed; });
+        oo = optional_t("def");
+        assert(value_changed == 1 && changed == 1);
+        oo = boost::none;
+        oo.emplace("ghi");
+        assert(oo->get() == "ghi");
+        oo->assign("jkl");
+        assert(*o == "jkl");
+        assert(value_changed == 2 && changed == 4);
+    }
+
+    //value of a disengaged optional
+    {
+        optional_t o;
+        observable::optional<optional_t> oo(o);
+        bool ok{false};
+        try { oo.value(); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+
+    //optional of a vector
+    {
+        using vector_t = std::vector<int>;
+        boost::optional<vector_t> o;
+        observable::optional<boost::optional<vector_t>> oo(o);
+        std::size_t inserted{0}, changed{0};
+        oo.on_change([&changed](const boost::optional<vector_t>&)
+                     { ++changed; });
+        oo.emplace();
+        oo->on_insert([&inserted](const vector_t&, vector_t::const_iterator)
+                      { ++inserted; });
+        oo->push_back(1);
+        oo->push_back(2);
+        assert((*o == vector_t{1, 2}));
+        assert(inserted == 2);
+        assert(changed == 3);
+    }
+
+    //optional of a class
+    {
+        boost::optional<foo_t> o;
+        observable::optional<boost::optional<foo_t>> oo(o);
+        std::size_t changed{0};
+        oo.on_change([&changed](const boost::optional<foo_t>&){ ++changed; });
+        oo = boost::optional<foo_t>(foo_t{1});
+        oo->get<i>().assign(5);
+        assert(o->i == 5);
+        assert(changed == 2);
+    }
+
+    //assignment of an engaged optional of a class emits the signal of
+    //the class but not the ones of its members
+    {
+        boost::optional<foo_t> o{foo_t{1}};
+        observable::optional<boost::optional<foo_t>> oo(o);
+        std::size_t class_changed{0}, member_changed{0};
+        oo->on_change([&class_changed](const foo_t&){ ++class_changed; });
+        oo->on_change<i>([&member_changed](int){ ++member_changed; });
+        oo = boost::optional<foo_t>(foo_t{2});
+        assert(o->i == 2);
+        assert(class_changed == 1);
+        assert(member_changed == 0);
+    }
+
+    //optional of a variant rebuilds the observable of the value when
+    //it stays engaged or is engaged again
+    {
+        using variant_t = boost::variant<int, std::string>;
+        using ovariant_t = observable::variant<variant_t>;
+        boost::optional<variant_t> o{variant_t{1}};
+        observable::optional<boost::optional<variant_t>> oo(o);
+        std::size_t value_changed{0};
+        oo->on_change([&value_changed](const variant_t&){ ++value_changed; });
+        auto alternative = [](ovariant_t& ov)
+        {
+            std::string s;
+            ov.match([&s](observable::value<int>& o)
+                     { s = std::to_string(o.get()); },
+                     [&s](observable::value<std::string>& o)
+                     { s = o.get(); });
+            return s;
+        };
+        oo = boost::optional<variant_t>(variant_t{std::string("abc")});
+        assert(value_changed == 1);
+        assert(alternative(*oo) == "abc");
+        oo.reset();
+        oo = boost::optional<variant_t>(variant_t{2});
+        assert(alternative(*oo) == "2");
+        oo = boost::optional<variant_t>(variant_t{std::string("def")});
+        assert(alternative(*oo) == "def");
+        assert(value_changed == 2);
+    }
+
+    //move
+    {
+        optional_t o("abc");
+        observable::optional<optional_t> oo(o);
+        std::size_t changed{0};
+        oo.on_change([&changed](const optional_t&){ ++changed; });
+        observable::optional<optional_t> moved(std::move(oo));
+        moved->assign("def");
+        assert(changed == 1);
+    }
+}
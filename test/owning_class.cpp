@@ -0,0 +1,127 @@
+#include "observable/map.hpp"
+#include "observable/observable_class_gen.hpp"
+#include "observable/owning_class.hpp"
+#include "observable/vector.hpp"
+
+#include <cassert>
+#include <map>
+#include <string>
+#include <vector>
+
+using skills_t = std::map<std::size_t, std::string>;
+using kids_t = std::vector<std::string>;
+
+OBSERVABLE_OWNING_CLASS_GEN(
+    person_t,
+    ((std::string, name))
+    ((observable::distinct<std::size_t>, age))
+    ((skills_t, skills))
+    ((kids_t, kids))
+);
+
+int main()
+{
+    //default ctor
+    {
+        person_t person;
+        assert(person.get<name>().get().empty());
+        assert(person.get<skills>().empty());
+    }
+
+    //ctor with the values of the members
+    {
+        const person_t person("maria", 26u, skills_t{{1, "c++"}}, kids_t{});
+        assert(person.get<name>().get() == "maria");
+        assert(person.get<age>().get() == 26);
+        assert(person.get<skills>().get().at(1) == "c++");
+        assert(person.get<kids>().get().empty());
+        assert(&person.get() == &person);
+    }
+
+    //value members are stored inline
+    {
+        person_t person;
+        auto begin = reinterpret_cast<const char*>(&person);
+        auto end = begin + sizeof(person);
+        auto name_ = reinterpret_cast<const char*>(&person.get<name>().get());
+        auto age_ = reinterpret_cast<const char*>(&person.get<age>().get());
+        assert(name_ >= begin && name_ < end);
+        assert(age_ >= begin && age_ < end);
+    }
+
+    //assign a value member
+    {
+        person_t person;
+        bool member_called{false}, called{false};
+        person.on_change<name>([&member_called](const std::string& s)
+                               {
+                                   assert(s == "maria");
+                                   member_called = true;
+                               });
+        person.on_change([&called](const person_t& p)
+                         {
+                             assert(p.get<name>().get() == "maria");
+                             called = true;
+                         });
+        person.assign<name>("maria");
+        assert(member_called);
+        assert(called);
+    }
+
+    //the equality policy of a member is used
+    {
+        person_t person("maria", 26u, skills_t{}, kids_t{});
+        std::size_t calls{0};
+        person.on_change([&calls](const person_t&){ ++calls; });
+        person.assign<age>(26u);
+        assert(calls == 0);
+        person.assign<age>(27u);
+        assert(calls == 1);
+    }
+
+    //modify a value member
+    {
+        person_t person("maria", 26u, skills_t{}, kids_t{});
+        bool called{false};
+        person.on_change([&called](const person_t&){ called = true; });
+        person.modify<name>([](std::string& s){ s += " silva"; });
+        assert(person.get<name>().get() == "maria silva");
+        assert(called);
+    }
+
+    //change a container member through its proxy
+    {
+        person_t person;
+        std::size_t calls{0};
+        person.on_change([&calls](const person_t&){ ++calls; });
+        person.get<skills>().emplace(1, "c++");
+        person.get<kids>().push_back("lucas");
+        assert(person.get<skills>().get().at(1) == "c++");
+        assert(person.get<kids>().get().front() == "lucas");
+        assert(calls == 2);
+    }
+
+    //on_member_change
+    {
+        person_t person;
+        std::size_t member{0};
+        person.on_member_change([&member](const person_t&, std::size_t m)
+                                { member = m; });
+        person.get<skills>().emplace(1, "c++");
+        assert(member == person_t::index<skills>());
+        person.assign<name>("maria");
+        assert(member == person_t::index<name>());
+    }
+
+    //on_change_any
+    {
+        person_t person;
+        std::size_t calls{0};
+        person.on_change_any<skills, kids>([&calls](const person_t&)
+                                           { ++calls; });
+        person.get<skills>().emplace(1, "c++");
+        person.assign<name>("maria");
+        person.get<kids>().push_back("lucas");
+        assert(calls == 2);
+    }
+}
@@ -0,0 +1,208 @@
+#include "observable/class.hpp"
+#include "observable/observable_is_class.hpp"
+#include "observable/path.hpp"
+#include "observable/vector.hpp"
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct kid_t
+{
+    std::string name;
+    std::size_t age;
+};
+
+struct name{};
+struct age{};
+
+using okid_t = observable::class_<
+    kid_t,
+    std::pair<std::string, name>,
+    std::pair<std::size_t, age>
+    >;
+
+okid_t observable_factory(kid_t& model)
+{ return okid_t(model, model.name, model.age); }
+
+OBSERVABLE_IS_CLASS(okid_t)
+
+using kids_t = std::vector<kid_t>;
+
+struct person_t
+{
+    std::string name;
+    kids_t kids;
+};
+
+struct kids{};
+
+using operson_t = observable::class_<
+    person_t,
+    std::pair<std::string, name>,
+    std::pair<kids_t, kids>
+    >;
+
+using observable::any;
+using observable::path_t;
+
+int main()
+{
+    //path of a member
+    {
+        person_t person{"maria", {}};
+        operson_t operson(person, person.name, person.kids);
+        std::vector<path_t> paths;
+        observable::on_path_change<name>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        operson.assign<name>("joana");
+        assert(paths.size() == 1);
+        assert(paths[0] == path_t{operson_t::index<name>()});
+    }
+
+    //path of a member of any element
+    {
+        person_t person{"maria", {{"lucas", 3}, {"josefina", 5}}};
+        operson_t operson(person, person.name, person.kids);
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any, name>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        auto& okids = operson.get<kids>();
+        okids[1]->assign<name>("JOSEFINA");
+        okids[1]->assign<age>(6u);
+        okids[0]->assign<name>("LUCAS");
+        assert(person.kids[1].name == "JOSEFINA");
+        assert(paths.size() == 2);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 1,
+                                   okid_t::index<name>()}));
+        assert((paths[1] == path_t{operson_t::index<kids>(), 0,
+                                   okid_t::index<name>()}));
+    }
+
+    //element observables alive before the connection are attached
+    {
+        person_t person{"maria", {{"lucas", 3}, {"josefina", 5}}};
+        operson_t operson(person, person.name, person.kids);
+        auto okid = operson.get<kids>()[1];
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any, age>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        okid->assign<age>(6u);
+        assert(paths.size() == 1);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 1,
+                                   okid_t::index<age>()}));
+    }
+
+    //the connection doesn't keep the element observables alive
+    {
+        person_t person{"maria", {{"lucas", 3}}};
+        operson_t operson(person, person.name, person.kids);
+        observable::on_path_change<kids, any, name>
+            (operson, [](const path_t&){});
+        auto& okids = operson.get<kids>();
+        okids[0]->assign<name>("LUCAS");
+        assert(okids._it2observable.empty());
+    }
+
+    //path ending at any element
+    {
+        person_t person{"maria", {{"lucas", 3}, {"josefina", 5}}};
+        operson_t operson(person, person.name, person.kids);
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        auto& okids = operson.get<kids>();
+        okids[1]->assign<age>(6u);
+        okids.modify(0, [](kid_t& k){ k.age = 4; });
+        assert(paths.size() == 2);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 1}));
+        assert((paths[1] == path_t{operson_t::index<kids>(), 0}));
+    }
+
+    //a change to a whole element is notified to the paths through it
+    {
+        person_t person{"maria", {{"lucas", 3}, {"josefina", 5}}};
+        operson_t operson(person, person.name, person.kids);
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any, name>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        auto& okids = operson.get<kids>();
+        okids.modify(1, [](kid_t& k){ k.name = "JOSEFINA"; });
+        auto okid = okids[0];
+        okids.modify(0, [](kid_t& k){ k.name = "LUCAS"; });
+        okid->assign<age>(4u);
+        assert(paths.size() == 2);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 1,
+                                   okid_t::index<name>()}));
+        assert((paths[1] == path_t{operson_t::index<kids>(), 0,
+                                   okid_t::index<name>()}));
+    }
+
+    //index of the element after an insertion and an erasure
+    {
+        person_t person{"maria", {{"lucas", 3}, {"josefina", 5}}};
+        operson_t operson(person, person.name, person.kids);
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any, name>
+            (operson, [&paths](const path_t& p){ paths.push_back(p); });
+        auto& okids = operson.get<kids>();
+        okids.insert(person.kids.begin(), kid_t{"ana", 1});
+        okids[2]->assign<name>("JOSEFINA");
+        okids.erase(okids.begin());
+        okids.erase(okids.begin());
+        okids[0]->assign<name>("Josefina");
+        assert(paths.size() == 2);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 2,
+                                   okid_t::index<name>()}));
+        assert((paths[1] == path_t{operson_t::index<kids>(), 0,
+                                   okid_t::index<name>()}));
+    }
+
+    //the path survives a move of the observable that it starts from
+    {
+        person_t person{"maria", {{"lucas", 3}}};
+        std::unique_ptr<operson_t> first
+            (new operson_t(person, person.name, person.kids));
+        std::vector<path_t> paths;
+        observable::on_path_change<kids, any, name>
+            (*first, [&paths](const path_t& p){ paths.push_back(p); });
+        operson_t operson(std::move(*first));
+        first.reset();
+        operson.get<kids>()[0]->assign<name>("LUCAS");
+        assert(paths.size() == 1);
+        assert((paths[0] == path_t{operson_t::index<kids>(), 0,
+                                   okid_t::index<name>()}));
+    }
+
+    //disconnect
+    {
+        person_t person{"maria", {{"lucas", 3}}};
+        operson_t operson(person, person.name, person.kids);
+        std::size_t calls{0};
+        auto c = observable::on_path_change<kids, any, name>
+            (operson, [&calls](const path_t&){ ++calls; });
+        auto okid = operson.get<kids>()[0];
+        assert(c.connected());
+        c.disconnect();
+        assert(!c.connected());
+        okid->assign<name>("LUCAS");
+        assert(calls == 0);
+    }
+
+    //disconnect closes the connections to the element observables,
+    //which release the slot
+    {
+        person_t person{"maria", {{"lucas", 3}}};
+        operson_t operson(person, person.name, person.kids);
+        auto token = std::make_shared<int>(0);
+        auto okid = operson.get<kids>()[0];
+        {
+            auto c = observable::on_path_change<kids, any, name>
+                (operson, [token](const path_t&){});
+            assert(token.use_count() > 1);
+            c.disconnect();
+        }
+        assert(token.use_count() == 1);
+    }
+}
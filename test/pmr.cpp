@@ -0,0 +1,75 @@
+#include "observable/class.hpp"
+#include "observable/map.hpp"
+#include "observable/vector.hpp"
+
+#include <cassert>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+#ifdef __cpp_lib_memory_resource
+
+#include <functional>
+#include <string>
+
+struct model_t
+{
+    model_t(std::pmr::memory_resource* r)
+        : samples(r)
+        , names(r)
+    {}
+
+    std::pmr::vector<double> samples;
+    std::pmr::map<std::pmr::string, int, std::less<>> names;
+};
+
+struct samples{};
+struct names{};
+
+using omodel_t = observable::class_<
+    model_t,
+    std::pair<std::pmr::vector<double>, samples>,
+    std::pair<std::pmr::map<std::pmr::string, int, std::less<>>, names>
+    >;
+
+int main()
+{
+    char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+    model_t model(&arena);
+    omodel_t omodel(model, model.samples, model.names);
+    std::size_t calls{0};
+    omodel.on_change([&calls](const model_t&){ ++calls; });
+
+    omodel.get<samples>().push_back(1.5);
+    omodel.get<names>().emplace("maria", 26);
+    assert(calls == 2);
+
+    //heterogeneous lookup without a temporary pmr::string. The observable
+    //of the element is allocated in the arena.
+    omodel.get<names>().find("maria")->second->assign(27);
+    assert(model.names.find("maria")->second == 27);
+    assert(calls == 3);
+
+    //the observable of a nested pmr container isn't constructed with
+    //the allocator
+    {
+        std::pmr::vector<std::pmr::vector<int>> vv(&arena);
+        vv.emplace_back(std::initializer_list<int>{1, 2});
+        observable::vector<std::pmr::vector<std::pmr::vector<int>>> ovv(vv);
+        std::size_t vv_calls{0};
+        ovv.on_change([&vv_calls](const std::pmr::vector<std::pmr::vector<int>>&)
+                      { ++vv_calls; });
+        ovv[0]->push_back(3);
+        assert(vv[0].size() == 3 && vv[0][2] == 3);
+        assert(vv_calls == 1);
+    }
+}
+
+#else
+
+int main() {}
+
+#endif
@@ -0,0 +1,111 @@
+#include "observable/ring_buffer.hpp"
+
+#include <boost/circular_buffer.hpp>
+
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+using buffer_t = boost::circular_buffer<int>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<buffer_t>,
+                  observable::ring_buffer<buffer_t>>::value, "");
+
+    //push_back evicts the front when full
+    {
+        buffer_t b(3);
+        observable::ring_buffer<buffer_t> ob(b);
+        std::vector<int> evicted, inserted;
+        ob.on_evict([&evicted](const buffer_t&, const int& e)
+                    { evicted.push_back(e); });
+        ob.on_insert([&inserted](const buffer_t&, buffer_t::const_iterator it)
+                     { inserted.push_back(*it); });
+        for (int i = 0; i < 5; ++i) ob.push_back(i);
+        assert((evicted == std::vector<int>{0, 1}));
+        assert((inserted == std::vector<int>{0, 1, 2, 3, 4}));
+        assert(ob.full());
+        assert(ob.front() == 2);
+        assert(ob.back() == 4);
+    }
+
+    //push_front evicts the back when full
+    {
+        buffer_t b(2);
+        observable::ring_buffer<buffer_t> ob(b);
+        std::vector<int> evicted;
+        ob.on_evict([&evicted](const buffer_t&, const int& e)
+                    { evicted.push_back(e); });
+        ob.push_front(1);
+        ob.push_front(2);
+        ob.push_front(3);
+        assert((evicted == std::vector<int>{1}));
+        assert(ob[0] == 3);
+        assert(ob[1] == 2);
+    }
+
+    //zero capacity
+    {
+        buffer_t b;
+        observable::ring_buffer<buffer_t> ob(b);
+        bool called{false};
+        ob.on_change([&called](const buffer_t&){ called = true; });
+        ob.on_evict([&called](const buffer_t&, const int&){ called = true; });
+        ob.push_back(1);
+        assert(ob.empty());
+        assert(!called);
+    }
+
+    //pop at both ends
+    {
+        buffer_t b(4);
+        b.push_back(0);
+        b.push_back(1);
+        b.push_back(2);
+        observable::ring_buffer<buffer_t> ob(b);
+        std::vector<int> before;
+        ob.before_erase([&before](const buffer_t&, buffer_t::const_iterator it)
+                        { before.push_back(*it); });
+        ob.pop_front();
+        ob.pop_back();
+        assert((before == std::vector<int>{0, 2}));
+        assert(ob.size() == 1);
+        assert(ob.front() == 1);
+    }
+
+    //set_capacity evicts the back and rset_capacity the front
+    {
+        buffer_t b(4);
+        for (int i = 0; i < 4; ++i) b.push_back(i);
+        observable::ring_buffer<buffer_t> ob(b);
+        std::vector<int> evicted;
+        ob.on_evict([&evicted](const buffer_t&, const int& e)
+                    { evicted.push_back(e); });
+        ob.set_capacity(3);
+        ob.rset_capacity(1);
+        assert((evicted == std::vector<int>{3, 0, 1}));
+        assert(ob.size() == 1);
+        assert(ob.front() == 2);
+    }
+
+    //modify
+    {
+        buffer_t b(2);
+        b.push_back(1);
+        observable::ring_buffer<buffer_t> ob(b);
+        bool called{false};
+        ob.on_value_change([&called](const buffer_t&,
+                                     buffer_t::const_iterator it)
+                           {
+                               assert(*it == 10);
+                               called = true;
+                           });
+        ob.modify(0, [](int& i){ i *= 10; });
+        assert(called);
+        bool ok{false};
+        try { ob.modify(1, [](int&){}); }
+        catch(const std::out_of_range&) { ok = true; }
+        assert(ok);
+    }
+}
@@ -0,0 +1,91 @@
+#include "observable/set.hpp"
+
+#include <cassert>
+#include <iterator>
+#include <set>
+#include <vector>
+
+using set_t = std::set<int>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<set_t>,
+                  observable::set<set_t>>::value, "");
+
+    //insert
+    {
+        set_t s;
+        observable::set<set_t> os(s);
+        std::vector<int> inserted;
+        std::size_t calls{0};
+        os.on_insert([&inserted](const set_t&, set_t::const_iterator it)
+                     { inserted.push_back(*it); });
+        os.on_change([&calls](const set_t&){ ++calls; });
+        assert(os.insert(2).second);
+        assert(os.emplace(1).second);
+        assert(*os.insert(os.cend(), 3) == 3);
+        assert((inserted == std::vector<int>{2, 1, 3}));
+        assert(calls == 3);
+        assert(!os.insert(2).second);
+        os.emplace_hint(os.cbegin(), 1);
+        assert(calls == 3);
+        assert((s == set_t{1, 2, 3}));
+    }
+
+    //range insert
+    {
+        set_t s{1};
+        observable::set<set_t> os(s);
+        std::size_t calls{0};
+        os.on_change([&calls](const set_t&){ ++calls; });
+        os.insert({1});
+        assert(calls == 0);
+        os.insert({1, 2, 3});
+        assert(calls == 1);
+        assert(os.size() == 3);
+    }
+
+    //erase
+    {
+        set_t s{1, 2, 3, 4};
+        observable::set<set_t> os(s);
+        std::vector<int> before;
+        std::size_t erased{0};
+        os.before_erase([&before](const set_t&, set_t::const_iterator it)
+                        { before.push_back(*it); });
+        os.on_erase([&erased](const set_t&, set_t::const_iterator)
+                    { ++erased; });
+        os.erase(os.find(1));
+        assert(os.erase(2) == 1);
+        assert(os.erase(2) == 0);
+        assert((before == std::vector<int>{1, 2}));
+        assert(erased == 2);
+        os.erase(os.lower_bound(3), os.upper_bound(4));
+        assert(os.empty());
+    }
+
+    //clear and swap
+    {
+        set_t s{1, 2};
+        observable::set<set_t> os(s);
+        std::size_t calls{0};
+        os.on_change([&calls](const set_t&){ ++calls; });
+        set_t other{3};
+        os.swap(other);
+        assert((s == set_t{3}));
+        os.clear();
+        assert(s.empty());
+        assert(calls == 2);
+    }
+
+    //lookup
+    {
+        set_t s{1, 2, 3};
+        observable::set<set_t> os(s);
+        assert(os.count(2) == 1);
+        auto rng = os.equal_range(2);
+        assert(std::distance(rng.first, rng.second) == 1);
+        assert(*os.lower_bound(2) == 2);
+        assert(*os.upper_bound(2) == 3);
+    }
+}
@@ -1,6 +1,7 @@
 #include <observable/class.hpp>
 #include <observable/observable_class_gen.hpp>
 #include <observable/setter_value.hpp>
+#include <cmath>
 #include <iostream>
 
 using namespace observable;
@@ -30,6 +31,11 @@ ofoo_t observable_factory(foo_t& o)
                   });
 }
 
+using mem_set_get_t = set_get<
+    float,
+    mem_setter<foo_t, float, &foo_t::val>,
+    mem_getter<foo_t, float, &foo_t::val>>;
+
 int main()
 {
     foo_t foo;
@@ -41,4 +47,52 @@ int main()
     ofoo.get<val>() = 7.6;
     assert(value_changed);
     assert((ofoo.get<val>().get() == 7.6) < 0.01);
+    
+    value_changed = false;
+    ofoo.modify<val>([](float& v){ v += 1; });
+    assert(value_changed);
+    assert(std::abs(ofoo.get<val>().get() - 8.6) < 0.01);
+    
+    //a getter that returns by value makes get() return a copy
+    {
+        auto setter = [&foo](float v){ foo.val(v); };
+        auto getter = [&foo]{ return foo.val() * 2; };
+        auto o = setter_value<set_get<float, decltype(setter),
+                                      decltype(getter)>>(
+            make_set_get<float>(setter, getter));
+        static_assert(std::is_same<decltype(o.get()), float>::value, "");
+        o.assign(2.5f);
+        assert(o.get() == 5.0f);
+        using ref_t = setter_value<mem_set_get_t>;
+        static_assert(std::is_same<decltype(std::declval<ref_t&>().get()),
+                                   const float&>::value, "");
+    }
+
+    //set_get with the callables types
+    {
+        auto setter = [&foo](float v){ foo.val(v); };
+        auto getter = [&foo]() -> const float& { return foo.val(); };
+        using sg_t = set_get<float, decltype(setter), decltype(getter)>;
+        static_assert(is_set_get<sg_t>::value, "");
+        using oinline_t = class_<foo_t, std::pair<sg_t, val>>;
+        oinline_t o(foo, make_set_get<float>(setter, getter));
+        bool called{false};
+        o.on_change<val>([&called](float){ called = true; });
+        auto o2 = std::move(o);
+        o2.assign<val>(1.5f);
+        assert(called);
+        assert(foo.val() == 1.5f);
+        assert(o2.get<val>().get() == 1.5f);
+    }
+    
+    //set_get with member functions
+    {
+        using omem_t = class_<foo_t, std::pair<mem_set_get_t, val>>;
+        omem_t o(foo, mem_set_get_t{{&foo}, {&foo}});
+        bool called{false};
+        o.on_change<val>([&called](float){ called = true; });
+        o.assign<val>(2.5f);
+        assert(called);
+        assert(foo.val() == 2.5f);
+    }
 }
@@ -0,0 +1,42 @@
+#include "observable/optional.hpp"
+
+#include <string>
+
+#ifndef BOOST_NO_CXX17_HDR_OPTIONAL
+
+#include <optional>
+
+using optional_t = std::optional<std::string>;
+
+using obs_t = observable::optional<optional_t>;
+
+int main()
+{
+    static_assert(observable::is_optional<optional_t>::value, "error");
+    static_assert(std::is_same<observable::observable_of_t<optional_t>,
+                               obs_t>::value, "error");
+    optional_t o;
+    obs_t oo(o);
+
+    bool engaged{false}, disengaged{false};
+    std::size_t changed{0};
+    oo.on_engage([&engaged](const optional_t&){ engaged = true; });
+    oo.on_disengage([&disengaged](const optional_t&){ disengaged = true; });
+    oo.on_change([&changed](const optional_t&){ ++changed; });
+
+    oo = optional_t("hi");
+    assert(engaged);
+    assert(*o == "hi");
+    oo->assign("hello");
+    assert(*o == "hello");
+    oo = std::nullopt;
+    assert(disengaged);
+    assert(!o);
+    assert(changed == 3);
+}
+
+#else
+
+int main() {}
+
+#endif
@@ -0,0 +1,129 @@
+#include "observable/class.hpp"
+#include "observable/observable_is_class.hpp"
+#include "observable/variant.hpp"
+
+#include <string>
+
+#ifndef BOOST_NO_CXX17_HDR_VARIANT
+
+#include <variant>
+
+struct foo_t{ int i; };
+struct i{};
+using ofoo_t = observable::class_<
+    foo_t,
+    std::pair<int, i>>;
+
+ofoo_t observable_factory(foo_t& o)
+{ return ofoo_t(o, o.i); }
+
+OBSERVABLE_IS_CLASS(ofoo_t)
+
+using variant_t = std::variant<int, std::string, foo_t>;
+
+using obs_t = observable::variant<variant_t>;
+
+using OInt = observable::observable_of_t<int>;
+using OString = observable::observable_of_t<std::string>;
+
+int main()
+{
+    static_assert(observable::is_variant<variant_t>::value, "error");
+    static_assert(std::is_same<observable::observable_of_t<variant_t>,
+                               obs_t>::value, "error");
+    variant_t var;
+    obs_t ovariant(var);
+
+    bool on_change{false};
+    bool on_change_type{false};
+    ovariant.on_change([&on_change](const variant_t&)
+                       { on_change = true;});
+    ovariant.on_change_type([&on_change_type](const variant_t&)
+                            { on_change_type = true;});
+    
+    ovariant = std::string("hi");
+    assert(on_change);
+    assert(on_change_type);
+    assert(std::get<std::string>(var) == "hi");
+    on_change = false;
+    on_change_type = false;
+    ovariant = std::string("hello");
+    assert(on_change);
+    assert(!on_change_type);
+
+    //match
+    {
+        bool called{false};
+        ovariant.match([](OInt&){},
+                       [&called](OString& o)
+                       {
+                           o.assign("abc");
+                           called = true;
+                       },
+                       [](ofoo_t&){});
+        assert(called);
+        assert(std::get<std::string>(var) == "abc");
+    }
+    
+    //same alternative keeps the observable of the alternative
+    {
+        std::size_t called{0};
+        ovariant.match([](OInt&){},
+                       [&called](OString& o)
+                       {
+                           o.on_change([&called](const std::string&)
+                                       { ++called; });
+                       },
+                       [](ofoo_t&){});
+        ovariant = std::string("def");
+        assert(called == 1);
+        ovariant = 1;
+        ovariant = std::string("ghi");
+        assert(called == 1);
+    }
+    
+    //class_ alternative
+    {
+        std::size_t called{0}, to_called{0};
+        ovariant.on_alternative<foo_t>([&called](const foo_t& foo)
+                                       { ++called; });
+        ovariant.on_change_to<foo_t>([&to_called](const foo_t& foo)
+                                     { ++to_called; });
+        ovariant = foo_t{1};
+        ovariant = foo_t{2};
+        assert(called == 2);
+        assert(to_called == 1);
+        ovariant.match([](OInt&){},
+                       [](OString&){},
+                       [](ofoo_t& o){ o.assign<i>(3); });
+        assert(std::get<foo_t>(var).i == 3);
+    }
+
+    //same alternative with a nested variant rebuilds its observable
+    {
+        using inner_t = std::variant<int, std::string>;
+        using outer_t = std::variant<double, inner_t>;
+        outer_t outer{inner_t{1}};
+        observable::variant<outer_t> oouter(outer);
+        std::size_t called{0};
+        oouter.match([](observable::value<double>&){},
+                     [&called](observable::variant<inner_t>& o)
+                     { o.on_change([&called](const inner_t&){ ++called; }); });
+        oouter = inner_t{std::string("abc")};
+        assert(called == 1);
+        std::string value;
+        oouter.match([](observable::value<double>&){},
+                     [&value](observable::variant<inner_t>& o)
+                     {
+                         o.match([](OInt&){ assert(false); },
+                                 [&value](OString& s){ value = s.get(); });
+                     });
+        assert(value == "abc");
+    }
+}
+
+#else
+
+int main() {}
+
+#endif
@@ -0,0 +1,133 @@
+#include "observable/class.hpp"
+#include "observable/throttle.hpp"
+#include "observable/value.hpp"
+#include "observable/vector.hpp"
+
+#include <chrono>
+#include <vector>
+
+struct manual_clock
+{
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<manual_clock>;
+    static const bool is_steady = true;
+    
+    static time_point now() noexcept
+    { return current; }
+
+    static void advance(duration d) noexcept
+    { current += d; }
+    
+    static time_point current;
+};
+
+manual_clock::time_point manual_clock::current;
+
+using queue_t = observable::timer_queue<manual_clock>;
+using ms = std::chrono::milliseconds;
+
+int main()
+{
+    //throttle
+    {
+        double d{0};
+        observable::value<double> od(d);
+        queue_t queue;
+        std::vector<double> calls;
+        observable::throttle(od, ms(10), queue,
+                             [&calls](double v){ calls.push_back(v); });
+        od = 1.0;
+        assert(calls == std::vector<double>{1.0});
+        manual_clock::advance(ms(1));
+        od = 2.0;
+        od = 3.0;
+        assert(calls.size() == 1);
+        assert(queue.size() == 1);
+        manual_clock::advance(ms(5));
+        assert(queue.run() == 0);
+        manual_clock::advance(ms(4));
+        assert(queue.run() == 1);
+        assert((calls == std::vector<double>{1.0, 3.0}));
+        manual_clock::advance(ms(20));
+        od = 4.0;
+        assert((calls == std::vector<double>{1.0, 3.0, 4.0}));
+        assert(queue.empty());
+    }
+    
+    //debounce
+    {
+        double d{0};
+        observable::value<double> od(d);
+        queue_t queue;
+        std::vector<double> calls;
+        observable::debounce(od, ms(10), queue,
+                             [&calls](double v){ calls.push_back(v); });
+        od = 1.0;
+        manual_clock::advance(ms(5));
+        od = 2.0;
+        manual_clock::advance(ms(5));
+        queue.run();
+        assert(calls.empty());
+        manual_clock::advance(ms(5));
+        queue.run();
+        assert(calls == std::vector<double>{2.0});
+        assert(queue.empty());
+    }
+    
+    //disconnected before the timer
+    {
+        double d{0};
+        observable::value<double> od(d);
+        queue_t queue;
+        bool called{false};
+        {
+            boost::signals2::scoped_connection c =
+                observable::debounce(od, ms(10), queue,
+                                     [&called](double){ called = true; });
+            od = 1.0;
+        }
+        od = 2.0;
+        manual_clock::advance(ms(10));
+        queue.run();
+        assert(!called);
+    }
+    
+    //the pending call receives the value notified by the change
+    {
+        std::vector<int> v{0};
+        observable::vector<std::vector<int>> ov(v);
+        queue_t queue;
+        std::vector<int> calls;
+        auto e = ov[0];
+        observable::debounce(*e, ms(10), queue,
+                             [&calls](int i){ calls.push_back(i); });
+        e->assign(1);
+        ov.clear();
+        v.assign(64, 2);
+        manual_clock::advance(ms(10));
+        queue.run();
+        assert(calls == std::vector<int>{1});
+    }
+    
+    //container
+    {
+        std::vector<int> v;
+        observable::vector<std::vector<int>> ov(v);
+        queue_t queue;
+        std::size_t called{0};
+        observable::throttle(ov, ms(10), queue,
+                             [&called](const std::vector<int>& v)
+                             {
+                                 assert(v.size() == called * 2 + 1);
+                                 ++called;
+                             });
+        ov.push_back(1);
+        ov.push_back(2);
+        ov.push_back(3);
+        manual_clock::advance(ms(10));
+        queue.run();
+        assert(called == 2);
+    }
+}
@@ -0,0 +1,108 @@
+#include "observable/class.hpp"
+#include "observable/observable_is_class.hpp"
+#include "observable/optional.hpp"
+#include "observable/tuple.hpp"
+#include "observable/vector.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cassert>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct foo_t{ int i; };
+struct i{};
+using ofoo_t = observable::class_<
+    foo_t,
+    std::pair<int, i>>;
+
+ofoo_t observable_factory(foo_t& o)
+{ return ofoo_t(o, o.i); }
+
+OBSERVABLE_IS_CLASS(ofoo_t)
+
+using tuple_t = std::tuple<int, std::string, std::vector<int>>;
+
+int main()
+{
+    static_assert(std::is_same<observable::observable_of_t<tuple_t>,
+                  observable::tuple<tuple_t>>::value, "");
+
+    //changes of the elements
+    {
+        tuple_t t;
+        observable::tuple<tuple_t> ot(t);
+        std::vector<std::size_t> elements;
+        std::size_t calls{0};
+        bool name{false};
+        ot.on_element_change([&elements](const tuple_t&, std::size_t e)
+                             { elements.push_back(e); });
+        ot.on_change([&calls](const tuple_t&){ ++calls; });
+        ot.on_change<1>([&name](const std::string& s)
+                        {
+                            assert(s == "abc");
+                            name = true;
+                        });
+        ot.assign<0>(5);
+        ot.assign<1>(std::string("abc"));
+        ot.get<2>().push_back(1);
+        ot.modify<0>([](int& v){ ++v; });
+        assert((elements == std::vector<std::size_t>{0, 1, 2, 0}));
+        assert(calls == 4);
+        assert(name);
+        assert(std::get<0>(t) == 6);
+        assert((std::get<2>(t) == std::vector<int>{1}));
+    }
+
+    //element of class type
+    {
+        using class_tuple_t = std::tuple<foo_t, int>;
+        class_tuple_t t;
+        observable::tuple<class_tuple_t> ot(t);
+        std::size_t calls{0};
+        ot.on_change([&calls](const class_tuple_t&){ ++calls; });
+        ot.get<0>().assign<i>(3);
+        assert(std::get<0>(t).i == 3);
+        assert(calls == 1);
+    }
+
+    //move
+    {
+        tuple_t t;
+        observable::tuple<tuple_t> ot(t);
+        std::size_t calls{0};
+        ot.on_change([&calls](const tuple_t&){ ++calls; });
+        observable::tuple<tuple_t> moved(std::move(ot));
+        moved.assign<0>(1);
+        assert(calls == 1);
+        assert(std::get<0>(t) == 1);
+    }
+
+    //tuple element of a vector
+    {
+        using pair_t = std::tuple<int, double>;
+        std::vector<pair_t> v{pair_t{1, 1.5}};
+        observable::vector<std::vector<pair_t>> ov(v);
+        std::size_t calls{0};
+        ov.on_change([&calls](const std::vector<pair_t>&){ ++calls; });
+        ov[0]->assign<0>(5);
+        assert(std::get<0>(v[0]) == 5);
+        assert(calls == 1);
+    }
+
+    //assignment of an engaged optional of a tuple
+    {
+        using pair_t = std::tuple<int, double>;
+        boost::optional<pair_t> o{pair_t{1, 1.5}};
+        observable::optional<boost::optional<pair_t>> oo(o);
+        std::size_t calls{0};
+        oo.on_change([&calls](const boost::optional<pair_t>&){ ++calls; });
+        oo = boost::optional<pair_t>(pair_t{2, 2.5});
+        assert(std::get<0>(*o) == 2);
+        assert(calls == 1);
+        oo->assign<1>(3.5);
+        assert(std::get<1>(*o) == 3.5);
+        assert(calls == 2);
+    }
+}
@@ -452,4 +452,170 @@ int main()
         assert(obs.get<map>().equal_range(4).first == obs.get<map>().end());
     }
 
+    //merge upsert
+    {
+        foo.map.clear();
+        foo.map.emplace(1, "abc");
+        foo.map.emplace(3, "def");
+        std::size_t inserted{0}, updated{0}, changed{0};
+        auto& omap = obs.get<map>();
+        boost::signals2::scoped_connection c1 =
+            omap.on_insert([&inserted](const map_t&, map_t::const_iterator it)
+                           {
+                               assert(it->first == 2);
+                               ++inserted;
+                           });
+        boost::signals2::scoped_connection c2 =
+            omap.on_value_change([&updated](const map_t&,
+                                            map_t::const_iterator it)
+                                 {
+                                     assert(it->first == 3);
+                                     ++updated;
+                                 });
+        boost::signals2::scoped_connection c3 =
+            obs.on_change([&changed](const foo_t&){ ++changed; });
+        map_t source{{2, "ghi"}, {3, "DEF"}};
+        auto ret = omap.merge(source);
+        assert(ret.inserted == 1);
+        assert(ret.updated == 1);
+        assert(ret.erased == 0);
+        assert(inserted == 1);
+        assert(updated == 1);
+        assert(changed == 1);
+        assert((foo.map == map_t{{1, "abc"}, {2, "ghi"}, {3, "DEF"}}));
+        assert(source.size() == 2);
+    }
+    
+    //merge notifies the observable of an updated value
+    {
+        map_t m{{1, "a"}, {2, "b"}};
+        observable::unordered_map<map_t> om(m);
+        std::size_t element_calls{0}, value_changes{0}, changes{0};
+        std::string last;
+        auto e = om.at(1);
+        e->on_change([&element_calls, &last](const std::string& s)
+                     {
+                         last = s;
+                         ++element_calls;
+                     });
+        om.on_value_change([&value_changes](const map_t&,
+                                            map_t::const_iterator)
+                           { ++value_changes; });
+        om.on_change([&changes](const map_t&){ ++changes; });
+        auto ret = om.merge(map_t{{1, "x"}, {2, "y"}});
+        assert(ret.updated == 2);
+        assert(element_calls == 1 && last == "x");
+        assert(value_changes == 2);
+        assert(changes == 1);
+        e->assign("z");
+        assert(element_calls == 2 && changes == 2);
+    }
+    
+    //merge replace
+    {
+        foo.map.clear();
+        foo.map.emplace(1, "abc");
+        foo.map.emplace(3, "def");
+        foo.map.emplace(5, "jkl");
+        std::size_t erased{0}, changed{0};
+        auto& omap = obs.get<map>();
+        boost::signals2::scoped_connection c1 =
+            omap.on_erase([&erased](const map_t&, map_t::value_type e,
+                                    map_t::const_iterator)
+                          {
+                              assert(e.first == 1 || e.first == 5);
+                              ++erased;
+                          });
+        boost::signals2::scoped_connection c2 =
+            obs.on_change([&changed](const foo_t&){ ++changed; });
+        observable::merge_result merged;
+        std::size_t merges{0};
+        boost::signals2::scoped_connection c3 =
+            omap.on_merge([&](const map_t&, const observable::merge_result& r)
+                          {
+                              assert(changed == 1);
+                              merged = r;
+                              ++merges;
+                          });
+        auto ret = omap.merge(map_t{{2, "ghi"}, {3, "def"}},
+                              observable::merge_policy::replace,
+                              std::equal_to<std::string>{});
+        assert(ret.inserted == 1);
+        assert(ret.updated == 0);
+        assert(ret.erased == 2);
+        assert(erased == 2);
+        assert(changed == 1);
+        assert(merges == 1);
+        assert(merged.inserted == 1 && merged.updated == 0
+               && merged.erased == 2);
+        assert((foo.map == map_t{{2, "ghi"}, {3, "def"}}));
+    }
+
+    //modify
+    {
+        foo.map.clear();
+        foo.map.emplace(2, "abc");
+        bool value_changed{false}, changed{false};
+        auto& omap = obs.get<map>();
+        boost::signals2::scoped_connection c1 =
+            omap.on_value_change([&value_changed](const map_t&,
+                                                  map_t::const_iterator it)
+                                 {
+                                     assert(it->first == 2);
+                                     assert(it->second == "ABC");
+                                     value_changed = true;
+                                 });
+        boost::signals2::scoped_connection c2 =
+            obs.on_change([&changed](const foo_t&){ changed = true; });
+        omap.modify(2, [](std::string& s){ s = "ABC"; });
+        assert(value_changed);
+        assert(changed);
+        assert(omap._it2observable.empty());
+        bool ok{false};
+        try
+        { omap.modify(0, [](std::string&){}); }
+        catch(const std::out_of_range&)
+        { ok = true; }
+        assert(ok);
+    }
+    
+    //rehash keeps the observables of the elements
+    {
+        map_t m{{1, "a"}, {2, "b"}};
+        observable::unordered_map<map_t> om(m);
+        auto ob = om.at(1);
+        std::size_t key{0};
+        boost::signals2::scoped_connection c =
+            om.on_value_change([&key](const map_t&, map_t::const_iterator it)
+                               { key = it->first; });
+        om.reserve(1000);
+        assert(om.bucket_count() >= 1000 / om.max_load_factor());
+        for (std::size_t i = 3; i < 100; ++i) om.emplace(i, "");
+        om.rehash(5000);
+        ob->assign("A");
+        assert(key == 1);
+        assert(m.at(1) == "A");
+        assert(om.at(1) == ob);
+    }
+    
+    //buckets
+    {
+        map_t m{{1, "a"}, {2, "b"}, {3, "c"}};
+        observable::unordered_map<map_t> om(m);
+        std::size_t n{0};
+        for (std::size_t b = 0; b < om.bucket_count(); ++b)
+        {
+            assert(om.bucket_size(b) == std::size_t(std::distance
+                                                    (om.cbegin(b), om.cend(b))));
+            for (auto it = om.begin(b); it != om.end(b); ++it, ++n)
+                assert((*it).second->get() == m.at((*it).first));
+        }
+        assert(n == 3);
+        assert(om.bucket(2) < om.bucket_count());
+        assert(om.load_factor() > 0);
+        om.max_load_factor(0.5f);
+        assert(om.max_load_factor() == 0.5f);
+        assert(om.hash_function()(2) == m.hash_function()(2));
+        assert(om.key_eq()(2, 2));
+    }
 }
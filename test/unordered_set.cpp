@@ -4,6 +4,7 @@
 #include <iostream>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 using set_t = std::unordered_set<std::string>;
 
@@ -262,5 +263,48 @@ int main()
     {
         assert(obs.empty());
     }
+    
+    //before_erase with each erased element
+    {
+        set_t s{"a", "b", "c", "d", "e"};
+        obs_t os(s);
+        std::vector<std::string> erased;
+        std::size_t calls{0};
+        os.before_erase([&erased](const set_t&, const std::string& v)
+                        { erased.push_back(v); });
+        os.on_erase([&calls](const set_t&, set_t::const_iterator)
+                    { ++calls; });
+        os.erase("a");
+        assert((erased == std::vector<std::string>{"a"}));
+        os.erase("a");
+        assert(erased.size() == 1);
+        erased.clear();
+        auto last = std::next(os.cbegin(), 2);
+        std::vector<std::string> expected(os.cbegin(), last);
+        os.erase(os.cbegin(), last);
+        assert(erased == expected);
+        erased.clear();
+        expected.assign(os.cbegin(), os.cend());
+        os.clear();
+        assert(erased == expected);
+        assert(calls == 3);
+    }
+    
+    //reserve and buckets
+    {
+        set_t s;
+        obs_t os(s);
+        os.reserve(100);
+        auto buckets = os.bucket_count();
+        assert(buckets >= 100 / os.max_load_factor());
+        for (std::size_t i = 0; i < 100; ++i) os.emplace(std::to_string(i));
+        assert(os.bucket_count() == buckets);
+        std::size_t n{0};
+        for (std::size_t b = 0; b < os.bucket_count(); ++b)
+            n += std::distance(os.begin(b), os.end(b));
+        assert(n == 100);
+        os.rehash(1000);
+        assert(os.count("7") == 1);
+    }
 }
 
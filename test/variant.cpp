@@ -51,6 +51,9 @@ struct visitor_on_change_t
 int main()
 {
     static_assert(observable::is_variant<variant_t>::value, "error");
+    static_assert(std::is_same<
+                  boost::mpl::at_c<obs_t::types, 1>::type,
+                  std::string>::value, "error");
     variant_t var;
     obs_t ovariant(var);
 
@@ -92,5 +95,49 @@ int main()
     ovariant.match([&ovariant_on_change](OInt&){ovariant_on_change = true;},
                    [](OString&){});
     assert(ovariant_on_change);
+    
+    //same alternative keeps the observable of the alternative
+    {
+        ovariant = "abc";
+        std::size_t called{0};
+        ovariant.match([](OInt&){},
+                       [&called](OString& o)
+                       {
+                           o.on_change([&called](const std::string&)
+                                       { ++called; });
+                       });
+        ovariant = "def";
+        assert(called == 1);
+        ovariant = "ghi";
+        assert(called == 2);
+        ovariant = 1;
+        ovariant = "jkl";
+        assert(called == 2);
+    }
+    
+    //on_alternative and on_change_to
+    {
+        ovariant = 0;
+        std::size_t int_called{0}, str_called{0}, to_str_called{0};
+        ovariant.on_alternative<int>([&int_called](const int& i)
+                                     { ++int_called; });
+        ovariant.on_alternative<std::string>(
+            [&str_called](const std::string& s)
+            {
+                assert(s == "abc");
+                ++str_called;
+            });
+        ovariant.on_change_to<std::string>(
+            [&to_str_called](const std::string&)
+            { ++to_str_called; });
+        ovariant = 1;
+        ovariant = 2;
+        assert(int_called == 2);
+        assert(str_called == 0);
+        ovariant = "abc";
+        ovariant = "abc";
+        assert(int_called == 2);
+        assert(str_called == 2);
+        assert(to_str_called == 1);
+    }
 }
-
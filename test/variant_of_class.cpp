@@ -28,6 +28,20 @@ obar_t observable_factory(bar_t& o)
     return obar_t(o, o.s);
 }
 
+using inner_t = boost::variant<int, std::string>;
+struct baz_t{ inner_t inner; };
+struct inner{};
+using obaz_t = observable::class_<
+    baz_t,
+    std::pair<inner_t, inner>>;
+
+OBSERVABLE_IS_CLASS(obaz_t)
+
+obaz_t observable_factory(baz_t& o)
+{
+    return obaz_t(o, o.inner);
+}
+
 using variant_t = boost::variant<foo_t, bar_t>;
 struct variant{};
 struct class_variant_t
@@ -100,5 +114,72 @@ int main()
     //                        {str_on_change, num_on_change});
     // ovariant.apply_visitor(visitor_t{});
     // assert(num_on_change);
-}
+    
+    //same alternative keeps the observable of the alternative
+    {
+        std::size_t called{0};
+        obar_t* obar{nullptr};
+        ovariant.match([](ofoo_t&){},
+                       [&called, &obar](obar_t& o)
+                       {
+                           obar = &o;
+                           o.on_change([&called](const bar_t&)
+                                       { ++called; });
+                       });
+        ovariant = bar_t{"abc"};
+        assert(called == 1);
+        obar->assign<s>("def");
+        assert(called == 2);
+        assert(boost::get<bar_t>(class_variant.variant).s == "def");
+    }
+
+    //same alternative emits the signal of the class but not the ones
+    //of its members
+    {
+        std::size_t class_called{0}, member_called{0};
+        ovariant = bar_t{"abc"};
+        ovariant.match([](ofoo_t&){},
+                       [&class_called, &member_called](obar_t& o)
+                       {
+                           o.on_change([&class_called](const bar_t&)
+                                       { ++class_called; });
+                           o.on_change<s>([&member_called](const std::string&)
+                                          { ++member_called; });
+                       });
+        ovariant = bar_t{"def"};
+        assert(class_called == 1);
+        assert(member_called == 0);
+    }
 
+    //same alternative with a nested variant rebuilds the observable of
+    //the alternative and keeps the slots of its on_change
+    {
+        using nested_t = boost::variant<foo_t, baz_t>;
+        nested_t nested{baz_t{1}};
+        observable::variant<nested_t> onested(nested);
+        std::size_t called{0};
+        onested.match([](ofoo_t&){},
+                      [&called](obaz_t& o)
+                      {
+                          o.on_change([&called](const baz_t&)
+                                      { ++called; });
+                      });
+        onested = baz_t{std::string("abc")};
+        assert(called == 1);
+        std::string inner_value;
+        onested.match(
+            [](ofoo_t&){ assert(false); },
+            [&inner_value](obaz_t& o)
+            {
+                o.get<inner>().match(
+                    [](observable::value<int>&){ assert(false); },
+                    [&inner_value](observable::value<std::string>& s)
+                    { inner_value = s.get(); });
+            });
+        assert(inner_value == "abc");
+        onested.match([](ofoo_t&){},
+                      [](obaz_t& o){ o.get<inner>() = 5; });
+        assert(called == 2);
+        assert(boost::get<int>(boost::get<baz_t>(nested).inner) == 5);
+    }
+}
@@ -446,5 +446,57 @@ int main()
         assert(*obs.cbegin() == "abc");
         assert(*std::next(obs.cbegin()) == "def");
     }
-
+    
+    //modify
+    {
+        vec.clear();
+        vec.push_back("abc");
+        vec.push_back("def");
+        bool value_changed{false}, changed{false};
+        boost::signals2::scoped_connection c1 =
+            obs.on_value_change([&value_changed](const vector_t&,
+                                                 vector_t::const_iterator it)
+                                {
+                                    assert(*it == "DEF");
+                                    value_changed = true;
+                                });
+        boost::signals2::scoped_connection c2 =
+            obs.on_change([&changed](const vector_t&){ changed = true; });
+        obs.modify(1, [](std::string& s){ s = "DEF"; });
+        assert(value_changed);
+        assert(changed);
+        assert(vec[1] == "DEF");
+        assert(obs._it2observable.empty());
+    }
+    
+    //modify out of range
+    {
+        vec.clear();
+        bool ok{false};
+        try
+        { obs.modify(0, [](std::string&){}); }
+        catch(const std::out_of_range&)
+        { ok = true; }
+        assert(ok);
+    }
+    
+    //modify with an alive observable of the element
+    {
+        vec.clear();
+        vec.push_back("abc");
+        auto ob = obs[0];
+        bool called{false}, value_changed{false};
+        ob->on_change([&called](const std::string& s)
+                      {
+                          assert(s == "ABC");
+                          called = true;
+                      });
+        boost::signals2::scoped_connection c =
+            obs.on_value_change([&value_changed](const vector_t&,
+                                                 vector_t::const_iterator)
+                                { value_changed = true; });
+        obs.modify(0, [](std::string& s){ s = "ABC"; });
+        assert(called);
+        assert(value_changed);
+    }
 }
@@ -90,4 +90,16 @@ int main()
     assert(element2_on_change);
     assert(s_on_change);
     assert(s2_on_change);
+    
+    //modify
+    {
+        foo_on_change = false;
+        elements_on_value_change = false;
+        element_on_change = false;
+        oelements.modify(0, [](element_t& e){ e.s = "GHI"; });
+        assert(foo.elements[0].s == "GHI");
+        assert(foo_on_change);
+        assert(elements_on_value_change);
+        assert(element_on_change);
+    }
 }